@@ -1,14 +1,18 @@
 #ifndef CARD_H
 #define CARD_H
-#include <string>
+#include <string_view>
+#include <cstdint>
+#include <type_traits>
 
 ///<summary> 
 ///Card class used in representing a typical playing like one used in the game of Poker.
+///A Card is stored as a single byte (suit * 13 + number) so it can be copied, sorted and moved around in hands as a plain value.
+///Descriptions are not stored in the card; they are looked up in a shared table.
 ///</summary>
 class Card
 {
 public:
-	enum class Suit
+	enum class Suit : uint8_t
 	{
 		CLUBS,
 		DIAMONDS,
@@ -17,40 +21,34 @@ public:
 	};
 	Card();
 	Card(int num, Card::Suit suit);
-	Card(int num, Card::Suit suit, std::string desc);
-	~Card();
-	Card::Suit getSuit();
-	int getNumber();
-	std::string getDescription();
-	bool operator<(Card &rightCard);
+	Card::Suit getSuit() const;
+	int getNumber() const;
+	std::string_view getDescription() const;
+	bool operator<(const Card &rightCard) const;
 
 private:
-	Card::Suit m_suit;
-	int m_number;
-	std::string m_description;
-	static std::string m_suitStrings[];
-	static std::string m_numStrings[];
+	static const int SUIT_SIZE = 13;
+	uint8_t m_index; // suit * 13 + number
+	// This table needs to stay in the same order as the Suit Public Enum
+	static constexpr std::string_view m_descriptions[] =
+	{
+		"Ace of Clubs", "Two of Clubs", "Three of Clubs", "Four of Clubs", "Five of Clubs", "Six of Clubs", "Seven of Clubs", "Eight of Clubs", "Nine of Clubs", "Ten of Clubs", "Jack of Clubs", "Queen of Clubs", "King of Clubs",
+		"Ace of Diamonds", "Two of Diamonds", "Three of Diamonds", "Four of Diamonds", "Five of Diamonds", "Six of Diamonds", "Seven of Diamonds", "Eight of Diamonds", "Nine of Diamonds", "Ten of Diamonds", "Jack of Diamonds", "Queen of Diamonds", "King of Diamonds",
+		"Ace of Hearts", "Two of Hearts", "Three of Hearts", "Four of Hearts", "Five of Hearts", "Six of Hearts", "Seven of Hearts", "Eight of Hearts", "Nine of Hearts", "Ten of Hearts", "Jack of Hearts", "Queen of Hearts", "King of Hearts",
+		"Ace of Spades", "Two of Spades", "Three of Spades", "Four of Spades", "Five of Spades", "Six of Spades", "Seven of Spades", "Eight of Spades", "Nine of Spades", "Ten of Spades", "Jack of Spades", "Queen of Spades", "King of Spades"
+	};
+	int getRank() const;
 };
 
-///<summary> 
-/// Constructor for Card object. Uses default constructor.
-///</summary>
-///<returns> Nothing. </returns>
-Card::Card()
-{
-}
+static_assert(sizeof(Card) == 1 && std::is_trivially_copyable<Card>::value, "Card must stay a one byte value so hands copy with memcpy");
 
-///<summary>
-///Constructor for Card object.
+///<summary> 
+/// Constructor for Card object. The card starts as the Ace of Clubs.
 ///</summary>
-///<param name="num"> Value on the card. 0 - Ace, 10 - Jack, 11 - Queen, 12 - King. All numerical values are represented by value-1. </param>
-///<param name="suit"> Suit of the card. </param>
 ///<returns> Nothing. </returns>
-Card::Card(int num, Card::Suit suit)
+inline Card::Card()
 {
-	m_number = num;
-	m_suit = suit;
-	m_description = Card::m_numStrings[num] + " of " + Card::m_suitStrings[static_cast<int>(suit)];
+	m_index = 0;
 }
 
 ///<summary>
@@ -58,41 +56,31 @@ Card::Card(int num, Card::Suit suit)
 ///</summary>
 ///<param name="num"> Value on the card. 0 - Ace, 10 - Jack, 11 - Queen, 12 - King. All numerical values are represented by value-1. </param>
 ///<param name="suit"> Suit of the card. </param>
-///<param name="desc"> Description of the card, using the card value and suit. (E.g., Ace of Spades) </param>
-///<returns> Nothing. </returns>
-Card::Card(int num, Card::Suit suit, std::string desc)
-{
-	// Make this constructor just for when we read all the data back and repopulate the collection
-	m_number = num;
-	m_suit = suit;
-	m_description = desc;
-}
-
-///<summary> Default destructor for Card class. No special actions taken. </summary>
 ///<returns> Nothing. </returns>
-Card::~Card()
+inline Card::Card(int num, Card::Suit suit)
 {
+	m_index = static_cast<uint8_t>(static_cast<int>(suit) * SUIT_SIZE + num);
 }
 
 ///<summary> Getter function for suit of the Card object. </summary>
 ///<returns> The suit of the Card using one of the values in Card::Suit. </returns>
-inline Card::Suit Card::getSuit()
+inline Card::Suit Card::getSuit() const
 {
-	return m_suit;
+	return static_cast<Card::Suit>(m_index / SUIT_SIZE);
 }
 
 ///<summary> Getter function for number of the Card object. </summary>
 ///<returns> An integer representing the card value. </returns>
-inline int Card::getNumber()
+inline int Card::getNumber() const
 {
-	return m_number;
+	return m_index % SUIT_SIZE;
 }
 
 ///<summary> Getter function for the description of the Card object. </summary>
-///<returns> The description of the card (E.g., 'Ace of Spades'). </returns>
-inline std::string Card::getDescription()
+///<returns> The description of the card (E.g., 'Ace of Spades'). Points into a static table, so it stays valid for the whole program. </returns>
+inline std::string_view Card::getDescription() const
 {
-	return m_description;
+	return m_descriptions[m_index];
 }
 
 ///<summary> 
@@ -102,47 +90,18 @@ inline std::string Card::getDescription()
 ///</summary>
 ///<param name="rightCard"> The card to the right of the '<' symbol. </param>
 ///<returns> True if the card to the left of the '<' symbol is of lower value than the card to the right, otherwise false. </returns>
-bool Card::operator<(Card & rightCard)
+inline bool Card::operator<(const Card &rightCard) const
 {
-	bool result = false;
-	Card::Suit rightCardSuit = rightCard.getSuit();
-	int rightCardNum = rightCard.getNumber();
-
-	if (rightCardSuit < m_suit)
-	{
-		result = false;
-	}
-	else if (rightCardSuit == m_suit)
-	{
-		// In a standard 52 card deck you can't have duplicates so no need to check that condition
-		// Ace is 0
-		if (m_number == 0)
-		{
-			result = false;
-		}
-		else if (rightCardNum == 0)
-		{
-			result = true;
-		}
-		// We've already checked for the Ace above, so for the next two conditions no need to account for it
-		else if (m_number > rightCardNum)
-		{
-			result = false;
-		}
-		else if (m_number < rightCardNum)
-		{
-			result = true;
-		}
-	}
-	else
-	{
-		result = true;
-	}
-	return result;
+	return getRank() < rightCard.getRank();
 }
 
-// This suit array needs to stay in the same order as the Suit Public Enum
-std::string Card::m_suitStrings[] = { "Clubs", "Diamonds", "Hearts", "Spades" };
-std::string Card::m_numStrings[] = { "Ace", "Two", "Three", "Four", "Five", "Six", "Seven", "Eight", "Nine", "Ten", "Jack", "Queen", "King" };
+///<summary> Gets the position of the card in a sorted deck, with the suit first and the Ace high. </summary>
+///<returns> A number from 0 (Two of Clubs) to 51 (Ace of Spades). </returns>
+inline int Card::getRank() const
+{
+	// Ace is 0, so move it above the King
+	int number = m_index % SUIT_SIZE;
+	return m_index - number + (number + SUIT_SIZE - 1) % SUIT_SIZE;
+}
 
 #endif // !CARD_H
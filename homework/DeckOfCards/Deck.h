@@ -1,12 +1,11 @@
 #ifndef DECK_H
 #define DECK_H
 #include <vector>
-#include <cstdlib>   // for srand() and rand()
 #include <algorithm> // for iter_swap() and min()
-#include <ctime>     // for time()
-#include <Windows.h>
 #include <iomanip>
 #include "Card.h"
+#include "Console.h"
+#include "RandomGenerator.h"
 
 ///<summary> 
 ///Deck class that holds Card objects. After creating a Deck object, it will be initialized as a 52 card deck with 4 suits (Clubs, Diamonds, Heart, Spades), 13 cards each 
@@ -15,27 +14,39 @@ class Deck
 {
 public:
 	Deck();
+	Deck(unsigned int seed);
 	~Deck();
+	void setSeed(unsigned int seed);
 	void shuffle();
+	template <class T> static void shuffleItems(T *items, int numItems, RandomGenerator &generator);
 	static void sort(std::vector<Card> &hand);
 	std::vector<std::vector<Card>> deal(int numHands, int handSize);
 	static void display(std::vector<std::vector<Card>> &handCollection);
 
 private:
 	std::vector<Card> m_cards;
+	RandomGenerator m_generator;
 	void initialize();
 	static void selectionSort(std::vector<Card> &hand);
 	static void mergeSort(std::vector<Card> &hand);
 	static void mergeCollection(std::vector<Card> &hand, int leftIndex, int midIndex, int rightIndex, std::vector<Card> &temp);
 };
 
-///<summary> Constructor for Deck object that sets up the cards in the deck. </summary>
+///<summary> Constructor for Deck object that sets up the cards in the deck. The shuffle generator is seeded from std::random_device. </summary>
 ///<returns> Nothing. </returns>
 Deck::Deck()
 {
 	this->initialize();
 }
 
+///<summary> Constructor for Deck object that sets up the cards in the deck with a seeded shuffle generator. </summary>
+///<param name="seed"> Seed for the deck's own random number generator. The same seed always gives the same shuffles. </param>
+///<returns> Nothing. </returns>
+Deck::Deck(unsigned int seed) : m_generator(seed)
+{
+	this->initialize();
+}
+
 ///<summary> Default destructor for Deck class. No special actions taken. </summary>
 ///<returns> Nothing. </returns>
 Deck::~Deck()
@@ -56,17 +67,41 @@ void Deck::initialize()
 	}
 }
 
-///<summary> Shuffle the Deck object by using a Fisher-Yates shuffle. All cards moved to random position. </summary>
+///<summary> Reseeds the deck's random number generator so the following shuffles can be reproduced. </summary>
+///<param name="seed"> Seed for the generator. </param>
+///<returns> Nothing. </returns>
+inline void Deck::setSeed(unsigned int seed)
+{
+	m_generator.seed(seed);
+}
+
+///<summary>
+///Shuffle the Deck object by using a Fisher-Yates shuffle. All cards moved to random position.
+///Each position is drawn from the cards not yet placed with RandomGenerator::nextBounded(), so every permutation is equally likely.
+///</summary>
 ///<returns> Nothing. </returns>
 void Deck::shuffle()
 {
-	srand(time(0));
+	Deck::shuffleItems(m_cards.data(), m_cards.size(), m_generator);
+}
+
+///<summary>
+///The Fisher-Yates shuffle used by shuffle(), for any array. Lets the shuffle quality tests run the same code as the deck
+///on plain arrays of any size without building a Deck for each shuffle.
+///</summary>
+///<param name="items"> Array to shuffle in place. </param>
+///<param name="numItems"> Number of items in the array. </param>
+///<param name="generator"> Generator to draw positions from. </param>
+///<returns> Nothing. </returns>
+template <class T>
+void Deck::shuffleItems(T *items, int numItems, RandomGenerator &generator)
+{
 	int random;
 	// Could use std::random_shuffle, but we can implement Fisher-Yates shuffle
-	for (int i = m_cards.size() - 1; i > 0; i--)
+	for (int i = numItems - 1; i > 0; i--)
 	{
-		random = rand() % 52;
-		iter_swap(m_cards.begin() + i, m_cards.begin() + random);
+		random = generator.nextBounded(i + 1);
+		std::iter_swap(items + i, items + random);
 	}
 }
 
@@ -113,32 +148,35 @@ std::vector<std::vector<Card>> Deck::deal(int numHands, int handSize)
 ///<returns> Nothing. </returns>
 void Deck::display(std::vector<std::vector<Card>> &handCollection)
 {
-	system("cls");
+	Console console;
+	console.beginFrame();
+	std::ostream &screen = console.frame();
 	int collectionSize = handCollection.size();
 	int handSize = handCollection.at(0).size(); // all hand sizes are the same
 	std::string tempStr;
 
-	std::cout << std::left;
+	screen << std::left;
 	for (int i = 0; i < collectionSize; i++)
 	{
 		tempStr = "Hand " + std::to_string(i + 1);
-		std::cout << std::setw(19) << tempStr;
+		screen << std::setw(19) << tempStr;
 	}
-	std::cout << '\n';
+	screen << '\n';
 	for (int i = 0; i < collectionSize; i++)
 	{
-		std::cout << std::setw(19) << "======";
+		screen << std::setw(19) << "======";
 	}
-	std::cout << '\n';
+	screen << '\n';
 	for (int i = 0; i < handSize; i++)
 	{
 		for (int j = 0; j < collectionSize; j++)
 		{
-			std::cout << std::setw(19) << std::left << handCollection.at(j).at(i).getDescription();
+			screen << std::setw(19) << std::left << handCollection.at(j).at(i).getDescription();
 		}
-		std::cout << '\n';
+		screen << '\n';
 	}
 
+	console.present();
 }
 
 ///<summary>
@@ -178,8 +216,8 @@ void Deck::mergeSort(std::vector<Card> &hand)
 		{
 			int leftStart = i;
 			// Very important to use min here, otherwise odd numbered collections cannot be sorted appropriately
-			int mid = min(i + width, n); // min() from algorithm library
-			int rightEnd = min(i + 2 * width, n);
+			int mid = std::min(i + width, n); // min() from algorithm library
+			int rightEnd = std::min(i + 2 * width, n);
 			mergeCollection(hand, leftStart, mid, rightEnd, temp);
 		}
 		// Copy temporary vector back into our final copy
@@ -0,0 +1,266 @@
+#ifndef BITHAND_H
+#define BITHAND_H
+#include <vector>
+#include <bitset>
+#include <cstdint>
+#include "Card.h"
+
+///<summary>
+///Hand of cards stored as a 52 bit set inside a single 64 bit integer. Each suit takes 13 bits, in the same order as Card::Suit.
+///Bit (suit * 13 + number) is set when the hand holds that card, so walking the bits from lowest to highest
+///visits the cards in the same order that Deck::sort() puts them in.
+///</summary>
+class BitHand
+{
+public:
+	static const int SUIT_SIZE = 13;
+	static const uint64_t SUIT_BITS = 0x1FFF;
+
+	BitHand();
+	BitHand(uint64_t bits);
+	BitHand(const std::vector<Card> &cards);
+	~BitHand();
+	uint64_t getBits() const;
+	void addCard(const Card &card);
+	void addCards(const std::vector<Card> &cards);
+	void removeCard(const Card &card);
+	void clear();
+	bool hasCard(const Card &card) const;
+	bool hasSuit(Card::Suit suit) const;
+	int countOfSuit(Card::Suit suit) const;
+	int size() const;
+	bool isEmpty() const;
+	BitHand cardsOfSuit(Card::Suit suit) const;
+	Card lowestCard() const;
+	std::vector<Card> toVector() const;
+	void toVector(std::vector<Card> &cards) const;
+
+	// Static Functions
+	static int cardIndex(const Card &card);
+	static Card indexToCard(int index);
+	static uint64_t cardBit(const Card &card);
+	static uint64_t suitMask(Card::Suit suit);
+	static int countBits(uint64_t bits);
+	static int lowestBitIndex(uint64_t bits);
+	static int highestBitIndex(uint64_t bits);
+
+private:
+	uint64_t m_bits;
+};
+
+///<summary> Constructor for an empty BitHand. </summary>
+///<returns> Nothing. </returns>
+inline BitHand::BitHand()
+{
+	m_bits = 0;
+}
+
+///<summary> Constructor for a BitHand from a raw bit set. </summary>
+///<param name="bits"> Bit set where bit (suit * 13 + number) represents a card. </param>
+///<returns> Nothing. </returns>
+inline BitHand::BitHand(uint64_t bits)
+{
+	m_bits = bits;
+}
+
+///<summary> Constructor for a BitHand holding the given cards. </summary>
+///<param name="cards"> Cards to put into the hand. </param>
+///<returns> Nothing. </returns>
+inline BitHand::BitHand(const std::vector<Card> &cards)
+{
+	m_bits = 0;
+	addCards(cards);
+}
+
+///<summary> Default destructor for BitHand class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+inline BitHand::~BitHand()
+{
+}
+
+///<summary> Getter for the raw bit set. </summary>
+///<returns> Bit set where bit (suit * 13 + number) represents a card. </returns>
+inline uint64_t BitHand::getBits() const
+{
+	return m_bits;
+}
+
+///<summary> Adds a card to the hand. </summary>
+///<param name="card"> Card to add. </param>
+///<returns> Nothing. </returns>
+inline void BitHand::addCard(const Card &card)
+{
+	m_bits |= cardBit(card);
+}
+
+///<summary> Adds a collection of cards to the hand. </summary>
+///<param name="cards"> Cards to add. </param>
+///<returns> Nothing. </returns>
+inline void BitHand::addCards(const std::vector<Card> &cards)
+{
+	for (const Card &card : cards)
+	{
+		m_bits |= cardBit(card);
+	}
+}
+
+///<summary> Removes a card from the hand. Nothing happens if the card is not in the hand. </summary>
+///<param name="card"> Card to remove. </param>
+///<returns> Nothing. </returns>
+inline void BitHand::removeCard(const Card &card)
+{
+	m_bits &= ~cardBit(card);
+}
+
+///<summary> Removes all cards from the hand. </summary>
+///<returns> Nothing. </returns>
+inline void BitHand::clear()
+{
+	m_bits = 0;
+}
+
+///<summary> Determines whether the hand holds a card. </summary>
+///<param name="card"> Card to look for. </param>
+///<returns> True if the card is in the hand, otherwise false. </returns>
+inline bool BitHand::hasCard(const Card &card) const
+{
+	return (m_bits & cardBit(card)) != 0;
+}
+
+///<summary> Determines whether the hand has at least one card of a suit. </summary>
+///<param name="suit"> Suit to look for. </param>
+///<returns> True if the hand has a card of the suit, otherwise false. </returns>
+inline bool BitHand::hasSuit(Card::Suit suit) const
+{
+	return (m_bits & suitMask(suit)) != 0;
+}
+
+///<summary> Counts the cards of a suit in the hand. </summary>
+///<param name="suit"> Suit to count. </param>
+///<returns> Number of cards of the suit. </returns>
+inline int BitHand::countOfSuit(Card::Suit suit) const
+{
+	return countBits(m_bits & suitMask(suit));
+}
+
+///<summary> Counts the cards in the hand. </summary>
+///<returns> Number of cards in the hand. </returns>
+inline int BitHand::size() const
+{
+	return countBits(m_bits);
+}
+
+///<summary> Determines whether the hand has no cards. </summary>
+///<returns> True if the hand is empty, otherwise false. </returns>
+inline bool BitHand::isEmpty() const
+{
+	return m_bits == 0;
+}
+
+///<summary> Gets only the cards of one suit. </summary>
+///<param name="suit"> Suit to keep. </param>
+///<returns> A BitHand with only the cards of the given suit. </returns>
+inline BitHand BitHand::cardsOfSuit(Card::Suit suit) const
+{
+	return BitHand(m_bits & suitMask(suit));
+}
+
+///<summary> Gets the lowest card in the hand, using the same ordering as Card::operator<. NOTE: Assumes the hand is not empty. </summary>
+///<returns> The lowest card in the hand. </returns>
+inline Card BitHand::lowestCard() const
+{
+	return indexToCard(lowestBitIndex(m_bits));
+}
+
+///<summary> Converts the hand into a vector of cards. </summary>
+///<returns> A vector of the cards in the hand, sorted from lowest to highest. </returns>
+std::vector<Card> BitHand::toVector() const
+{
+	std::vector<Card> cards;
+	cards.reserve(size());
+	uint64_t remaining = m_bits;
+	while (remaining != 0)
+	{
+		cards.push_back(indexToCard(lowestBitIndex(remaining)));
+		remaining &= remaining - 1; // clears the lowest set bit
+	}
+	return cards;
+}
+
+///<summary> Converts the hand into a vector of cards, reusing an existing vector so no memory is allocated once it is big enough. </summary>
+///<param name="cards"> Vector to fill. Anything already in it is removed. Filled sorted from lowest to highest. </param>
+///<returns> Nothing. </returns>
+inline void BitHand::toVector(std::vector<Card> &cards) const
+{
+	cards.clear();
+	for (uint64_t remaining = m_bits; remaining != 0; remaining &= remaining - 1)
+	{
+		cards.push_back(indexToCard(lowestBitIndex(remaining)));
+	}
+}
+
+///<summary> Finds the bit position used for a card. </summary>
+///<param name="card"> Card to find the position of. </param>
+///<returns> Bit position (suit * 13 + number), 0 to 51. </returns>
+inline int BitHand::cardIndex(const Card &card)
+{
+	return card.getIndex();
+}
+
+///<summary> Converts a bit position back into a card. </summary>
+///<param name="index"> Bit position (suit * 13 + number), 0 to 51. </param>
+///<returns> The card at that position. </returns>
+inline Card BitHand::indexToCard(int index)
+{
+	return Card(index % SUIT_SIZE, static_cast<Card::Suit>(index / SUIT_SIZE));
+}
+
+///<summary> Gets the single bit used for a card. </summary>
+///<param name="card"> Card to get the bit for. </param>
+///<returns> A bit set with only the given card's bit set. </returns>
+inline uint64_t BitHand::cardBit(const Card &card)
+{
+	return uint64_t(1) << cardIndex(card);
+}
+
+///<summary> Gets the bits that belong to a suit. </summary>
+///<param name="suit"> Suit to get the bits for. </param>
+///<returns> A bit set with all 13 bits of the suit set. </returns>
+inline uint64_t BitHand::suitMask(Card::Suit suit)
+{
+	return SUIT_BITS << (static_cast<int>(suit) * SUIT_SIZE);
+}
+
+///<summary> Counts the set bits (population count). std::bitset compiles down to the processor's popcount instruction where available. </summary>
+///<param name="bits"> Bits to count. </param>
+///<returns> Number of set bits. </returns>
+inline int BitHand::countBits(uint64_t bits)
+{
+	return static_cast<int>(std::bitset<64>(bits).count());
+}
+
+///<summary> Finds the position of the lowest set bit. NOTE: Assumes at least one bit is set. </summary>
+///<param name="bits"> Bits to search. </param>
+///<returns> Position of the lowest set bit. </returns>
+inline int BitHand::lowestBitIndex(uint64_t bits)
+{
+	// Isolate the lowest bit then count the zeros below it
+	return countBits((bits & (~bits + 1)) - 1);
+}
+
+///<summary> Finds the position of the highest set bit. NOTE: Assumes at least one bit is set. </summary>
+///<param name="bits"> Bits to search. </param>
+///<returns> Position of the highest set bit. </returns>
+inline int BitHand::highestBitIndex(uint64_t bits)
+{
+	// Smear the highest bit into every lower position, then the count of set bits gives its position
+	bits |= bits >> 1;
+	bits |= bits >> 2;
+	bits |= bits >> 4;
+	bits |= bits >> 8;
+	bits |= bits >> 16;
+	bits |= bits >> 32;
+	return countBits(bits) - 1;
+}
+
+#endif // !BITHAND_H
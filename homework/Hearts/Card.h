@@ -1,14 +1,18 @@
 #ifndef CARD_H
 #define CARD_H
-#include <string>
+#include <string_view>
+#include <cstdint>
+#include <type_traits>
 
 ///<summary> 
 ///Card class used in representing a typical playing like one used in the game of Poker.
+///A Card is stored as a single byte (suit * 13 + number) so it can be copied, sorted and moved around in hands as a plain value.
+///Descriptions are not stored in the card; they are looked up in a shared table.
 ///</summary>
 class Card
 {
 public:
-	enum class Suit
+	enum class Suit : uint8_t
 	{
 		CLUBS,
 		DIAMONDS,
@@ -17,43 +21,37 @@ public:
 	};
 	Card();
 	Card(int num, Card::Suit suit);
-	Card(int num, Card::Suit suit, std::string desc);
-	~Card();
-	Card::Suit getSuit();
-	int getNumber();
-	std::string getDescription();
+	Card::Suit getSuit() const;
+	int getNumber() const;
+	int getIndex() const;
+	std::string_view getDescription() const;
 	void setNumAndSuit(int num, Card::Suit suit);
-	bool operator<(Card &rightCard);
-	bool operator==(const Card &rightCard);
-	bool operator!=(Card &rightCard);
+	bool operator<(const Card &rightCard) const;
+	bool operator==(const Card &rightCard) const;
+	bool operator!=(const Card &rightCard) const;
 
 private:
-	Card::Suit m_suit;
-	int m_number;
-	std::string m_description;
-	static std::string m_suitStrings[];
-	static std::string m_numStrings[];
+	static const int SUIT_SIZE = 13;
+	uint8_t m_index; // suit * 13 + number, so cards compare in the same order as operator<
+	// This table needs to stay in the same order as the Suit Public Enum
+	static constexpr std::string_view m_descriptions[] =
+	{
+		"2 Clubs", "3 Clubs", "4 Clubs", "5 Clubs", "6 Clubs", "7 Clubs", "8 Clubs", "9 Clubs", "10 Clubs", "Jack Clubs", "Queen Clubs", "King Clubs", "Ace Clubs",
+		"2 Diamonds", "3 Diamonds", "4 Diamonds", "5 Diamonds", "6 Diamonds", "7 Diamonds", "8 Diamonds", "9 Diamonds", "10 Diamonds", "Jack Diamonds", "Queen Diamonds", "King Diamonds", "Ace Diamonds",
+		"2 Hearts", "3 Hearts", "4 Hearts", "5 Hearts", "6 Hearts", "7 Hearts", "8 Hearts", "9 Hearts", "10 Hearts", "Jack Hearts", "Queen Hearts", "King Hearts", "Ace Hearts",
+		"2 Spades", "3 Spades", "4 Spades", "5 Spades", "6 Spades", "7 Spades", "8 Spades", "9 Spades", "10 Spades", "Jack Spades", "Queen Spades", "King Spades", "Ace Spades"
+	};
 };
 
-///<summary> 
-/// Constructor for Card object. Uses default constructor.
-///</summary>
-///<returns> Nothing. </returns>
-Card::Card()
-{
-}
+static_assert(sizeof(Card) == 1 && std::is_trivially_copyable<Card>::value, "Card must stay a one byte value so hands copy with memcpy");
 
-///<summary>
-///Constructor for Card object.
+///<summary> 
+/// Constructor for Card object. The card starts as the 2 of Clubs.
 ///</summary>
-///<param name="num"> Value on the card. 9 - Jack, 10 - Queen, 11 - King, 12 - Ace. All numerical values are represented by value-2. </param>
-///<param name="suit"> Suit of the card. </param>
 ///<returns> Nothing. </returns>
-Card::Card(int num, Card::Suit suit)
+inline Card::Card()
 {
-	m_number = num;
-	m_suit = suit;
-	m_description = Card::m_numStrings[num] + " " + Card::m_suitStrings[static_cast<int>(suit)];
+	m_index = 0;
 }
 
 ///<summary>
@@ -61,41 +59,38 @@ Card::Card(int num, Card::Suit suit)
 ///</summary>
 ///<param name="num"> Value on the card. 9 - Jack, 10 - Queen, 11 - King, 12 - Ace. All numerical values are represented by value-2. </param>
 ///<param name="suit"> Suit of the card. </param>
-///<param name="desc"> Description of the card, using the card value and suit. (E.g., Spades Ace) </param>
 ///<returns> Nothing. </returns>
-Card::Card(int num, Card::Suit suit, std::string desc)
-{
-	// Make this constructor just for when we read all the data back and repopulate the collection
-	m_number = num;
-	m_suit = suit;
-	m_description = desc;
-}
-
-///<summary> Default destructor for Card class. No special actions taken. </summary>
-///<returns> Nothing. </returns>
-Card::~Card()
+inline Card::Card(int num, Card::Suit suit)
 {
+	m_index = static_cast<uint8_t>(static_cast<int>(suit) * SUIT_SIZE + num);
 }
 
 ///<summary> Getter function for suit of the Card object. </summary>
 ///<returns> The suit of the Card using one of the values in Card::Suit. </returns>
-inline Card::Suit Card::getSuit()
+inline Card::Suit Card::getSuit() const
 {
-	return m_suit;
+	return static_cast<Card::Suit>(m_index / SUIT_SIZE);
 }
 
 ///<summary> Getter function for number of the Card object. </summary>
 ///<returns> An integer representing the card value. </returns>
-inline int Card::getNumber()
+inline int Card::getNumber() const
+{
+	return m_index % SUIT_SIZE;
+}
+
+///<summary> Getter function for the position of the Card object in a sorted deck. </summary>
+///<returns> The card's index (suit * 13 + number), 0 to 51. </returns>
+inline int Card::getIndex() const
 {
-	return m_number;
+	return m_index;
 }
 
 ///<summary> Getter function for the description of the Card object. </summary>
-///<returns> The description of the card (E.g., 'Spades Ace'). </returns>
-inline std::string Card::getDescription()
+///<returns> The description of the card (E.g., 'Ace Spades'). Points into a static table, so it stays valid for the whole program. </returns>
+inline std::string_view Card::getDescription() const
 {
-	return m_description;
+	return m_descriptions[m_index];
 }
 
 ///<summary>
@@ -104,11 +99,9 @@ inline std::string Card::getDescription()
 ///<param name="num"> Value on the card. 9 - Jack, 10 - Queen, 11 - King, 12 - Ace. All numerical values are represented by value minus 2. </param>
 ///<param name="suit"> Suit of the card. </param>
 ///<returns> Nothing. </returns>
-void Card::setNumAndSuit(int num, Card::Suit suit)
+inline void Card::setNumAndSuit(int num, Card::Suit suit)
 {
-	m_number = num;
-	m_suit = suit;
-	m_description = Card::m_numStrings[num] + " " + Card::m_suitStrings[static_cast<int>(suit)];
+	m_index = static_cast<uint8_t>(static_cast<int>(suit) * SUIT_SIZE + num);
 }
 
 ///<summary> 
@@ -118,33 +111,10 @@ void Card::setNumAndSuit(int num, Card::Suit suit)
 ///</summary>
 ///<param name="rightCard"> The card to the right of the '<' symbol. </param>
 ///<returns> True if the card to the left of the '<' symbol is of lower value than the card to the right, otherwise false. </returns>
-bool Card::operator<(Card & rightCard)
+inline bool Card::operator<(const Card &rightCard) const
 {
-	bool result = false;
-	Card::Suit rightCardSuit = rightCard.getSuit();
-	int rightCardNum = rightCard.getNumber();
-
-	if (rightCardSuit < m_suit)
-	{
-		result = false;
-	}
-	else if (rightCardSuit == m_suit)
-	{
-		// In a standard 52 card deck you can't have duplicates so no need to check that condition
-		if (m_number > rightCardNum)
-		{
-			result = false;
-		}
-		else
-		{
-			result = true;
-		}
-	}
-	else
-	{
-		result = true;
-	}
-	return result;
+	// The index puts the suit first, so comparing indexes compares suit and then number
+	return m_index < rightCard.m_index;
 }
 
 ///<summary> 
@@ -152,9 +122,9 @@ bool Card::operator<(Card & rightCard)
 ///</summary>
 ///<param name="rightCard"> The card to the right of the '==' symbol. </param>
 ///<returns> True if both the left and right cards have the same number and suit, otherwise false. </returns>	
-bool Card::operator==(const Card & rightCard)
+inline bool Card::operator==(const Card &rightCard) const
 {
-	return (this->m_number == rightCard.m_number && this->m_suit == rightCard.m_suit);
+	return m_index == rightCard.m_index;
 }
 
 ///<summary> 
@@ -162,16 +132,9 @@ bool Card::operator==(const Card & rightCard)
 ///</summary>
 ///<param name="rightCard"> The card to the right of the '!=' symbol. </param>
 ///<returns> True if either the number or suit is different for the left and right card, otherwise false. </returns>
-bool Card::operator!=(Card &rightCard)
+inline bool Card::operator!=(const Card &rightCard) const
 {
-	if (m_number != rightCard.getNumber() || m_suit != rightCard.getSuit())
-	{
-		return true;
-	}
-	return false;
+	return m_index != rightCard.m_index;
 }
-// This suit array needs to stay in the same order as the Suit Public Enum
-std::string Card::m_suitStrings[] = { "Clubs", "Diamonds", "Hearts", "Spades" };
-std::string Card::m_numStrings[] = { "2", "3", "4", "5", "6", "7", "8", "9", "10", "Jack", "Queen", "King", "Ace" };
 
 #endif // !CARD_H
\ No newline at end of file
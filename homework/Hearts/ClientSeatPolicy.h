@@ -0,0 +1,273 @@
+#ifndef CLIENTSEATPOLICY_H
+#define CLIENTSEATPOLICY_H
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <mutex>
+#include <functional>
+#include "Card.h"
+#include "BitHand.h"
+#include "PlayerPolicy.h"
+#include "HeartsState.h"
+
+///<summary>
+///Message from a table to the client playing one of its seats. Has no pointers and a fixed size, like HeartsState,
+///so it can be queued, copied, or sent over a connection as raw bytes. Cards are BitHand bit sets and positions.
+///</summary>
+struct SeatRequest
+{
+	enum class Type { PASS_CARDS, PLAY_CARD, GAME_OVER };
+
+	Type type;
+	int tableId;
+	int seat;
+	int numPlayers;
+	int passOffset;					// PASS_CARDS: the cards go to the player this many seats after
+	int numCards;					// PASS_CARDS: number of cards to pass
+	uint64_t hand;
+	uint64_t playableCards;			// PLAY_CARD: the legal cards, one of which has to be played
+	int trickSize;					// PLAY_CARD: cards played so far in the trick
+	uint8_t trickCards[HeartsState::MAX_PLAYERS];
+	int pointsTotal;				// GAME_OVER: the seat's final score
+};
+
+///<summary> Message from a client back to its table, answering the last PASS_CARDS or PLAY_CARD request for its seat. </summary>
+struct SeatReply
+{
+	int tableId;
+	int seat;
+	uint64_t cards;					// The cards to pass, or the single card to play
+};
+
+///<summary>
+///PlayerPolicy for a seat played by a client that talks to the game through messages instead of being called directly.
+///When the game asks whether the seat is ready, a request is sent to the client and the seat reports not ready until
+///receive() has been given a legal answer. An illegal answer is dropped and the request is sent again. Only the first
+///answer to each request is kept: any that arrive after it, or when no request is waiting, are dropped too.
+///receive() may be called from any thread. The rest is only called by the thread playing the seat's game.
+///</summary>
+class ClientSeatPolicy : public PlayerPolicy
+{
+public:
+	ClientSeatPolicy(int tableId, int seat, std::function<void(const SeatRequest&)> send);
+	~ClientSeatPolicy();
+	std::string getName();
+	std::vector<Card> chooseCardsToPass(const std::vector<Card> &hand, int playerIndex, int numPlayers, int passOffset, int numCards);
+	Card chooseCardToPlay(const PlayView &view);
+	bool isReadyToPass(const std::vector<Card> &hand, int playerIndex, int numPlayers, int passOffset, int numCards);
+	bool isReadyToPlay(const PlayView &view);
+	void receive(const SeatReply &reply);
+	void sendGameOver(int pointsTotal);
+	int getRejectedReplies();
+
+private:
+	int m_tableId;
+	int m_seat;
+	std::function<void(const SeatRequest&)> m_send;
+	std::mutex m_mutex;
+	// Progress of the current decision
+	bool m_isRequestSent;
+	bool m_hasReply;
+	bool m_isAccepted;
+	uint64_t m_replyCards;
+	int m_rejectedReplies;
+
+	bool checkReply(uint64_t allowedCards, int numCards);
+	SeatRequest makeRequest(SeatRequest::Type type, const std::vector<Card> &hand, int numPlayers);
+};
+
+///<summary> Constructor for a ClientSeatPolicy. </summary>
+///<param name="tableId"> Table the seat belongs to, copied into every request. </param>
+///<param name="seat"> Index of the seat at the table. </param>
+///<param name="send"> Delivers a request to the client. Called without any lock held. </param>
+///<returns> Nothing. </returns>
+ClientSeatPolicy::ClientSeatPolicy(int tableId, int seat, std::function<void(const SeatRequest&)> send)
+{
+	m_tableId = tableId;
+	m_seat = seat;
+	m_send = send;
+	m_isRequestSent = false;
+	m_hasReply = false;
+	m_isAccepted = false;
+	m_replyCards = 0;
+	m_rejectedReplies = 0;
+}
+
+///<summary> Default destructor for ClientSeatPolicy class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+ClientSeatPolicy::~ClientSeatPolicy()
+{
+}
+
+///<summary> Getter for the name of the policy. </summary>
+///<returns> The name of the policy. </returns>
+inline std::string ClientSeatPolicy::getName()
+{
+	return "Client";
+}
+
+///<summary> Hands over the cards the client chose to pass. Only called after isReadyToPass() returned true. </summary>
+///<param name="hand"> The player's current hand. </param>
+///<param name="playerIndex"> Index of the player passing cards. </param>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<param name="passOffset"> The cards go to the player this many seats after this one. </param>
+///<param name="numCards"> Number of cards to select. </param>
+///<returns> A vector of distinct cards from the hand. </returns>
+std::vector<Card> ClientSeatPolicy::chooseCardsToPass(const std::vector<Card> &/*hand*/, int /*playerIndex*/, int /*numPlayers*/, int /*passOffset*/, int /*numCards*/)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_isAccepted = false;
+	m_isRequestSent = false;
+	return BitHand(m_replyCards).toVector();
+}
+
+///<summary> Hands over the card the client chose to play. Only called after isReadyToPlay() returned true. </summary>
+///<param name="view"> The current state of the trick as seen by the player. </param>
+///<returns> The card to play. </returns>
+Card ClientSeatPolicy::chooseCardToPlay(const PlayView &/*view*/)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_isAccepted = false;
+	m_isRequestSent = false;
+	return BitHand::indexToCard(BitHand::lowestBitIndex(m_replyCards));
+}
+
+///<summary> Checks whether the client has chosen its cards to pass, sending it a request the first time it is asked. </summary>
+///<param name="hand"> The player's current hand. </param>
+///<param name="playerIndex"> Index of the player passing cards. </param>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<param name="passOffset"> The cards go to the player this many seats after this one. </param>
+///<param name="numCards"> Number of cards to select. </param>
+///<returns> True if a legal answer has arrived, otherwise false. </returns>
+bool ClientSeatPolicy::isReadyToPass(const std::vector<Card> &hand, int /*playerIndex*/, int numPlayers, int passOffset, int numCards)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	if (ClientSeatPolicy::checkReply(BitHand(hand).getBits(), numCards))
+	{
+		return true;
+	}
+	if (m_isRequestSent)
+	{
+		return false;
+	}
+	m_isRequestSent = true;
+	lock.unlock();
+
+	SeatRequest request = ClientSeatPolicy::makeRequest(SeatRequest::Type::PASS_CARDS, hand, numPlayers);
+	request.passOffset = passOffset;
+	request.numCards = numCards;
+	m_send(request);
+	return false;
+}
+
+///<summary> Checks whether the client has chosen its card to play, sending it a request the first time it is asked. </summary>
+///<param name="view"> The current state of the trick as seen by the player. </param>
+///<returns> True if a legal answer has arrived, otherwise false. </returns>
+bool ClientSeatPolicy::isReadyToPlay(const PlayView &view)
+{
+	std::unique_lock<std::mutex> lock(m_mutex);
+	if (ClientSeatPolicy::checkReply(BitHand(view.playableCards).getBits(), 1))
+	{
+		return true;
+	}
+	if (m_isRequestSent)
+	{
+		return false;
+	}
+	m_isRequestSent = true;
+	lock.unlock();
+
+	SeatRequest request = ClientSeatPolicy::makeRequest(SeatRequest::Type::PLAY_CARD, view.hand, view.numPlayers);
+	request.passOffset = view.passOffset;
+	request.playableCards = BitHand(view.playableCards).getBits();
+	request.trickSize = view.trickCards.size();
+	for (int i = 0; i < request.trickSize && i < HeartsState::MAX_PLAYERS; i++)
+	{
+		request.trickCards[i] = static_cast<uint8_t>(view.trickCards.at(i).getIndex());
+	}
+	m_send(request);
+	return false;
+}
+
+///<summary>
+///Takes an answer from the client. It is checked the next time the game asks whether the seat is ready.
+///A duplicate, late, or unasked for answer is dropped, so it can never replace cards that were already checked.
+///</summary>
+///<param name="reply"> The client's answer. </param>
+///<returns> Nothing. </returns>
+void ClientSeatPolicy::receive(const SeatReply &reply)
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (!m_isRequestSent || m_hasReply || m_isAccepted)
+	{
+		m_rejectedReplies++;
+		return;
+	}
+	m_replyCards = reply.cards;
+	m_hasReply = true;
+}
+
+///<summary> Tells the client the game has ended. </summary>
+///<param name="pointsTotal"> The seat's final score. </param>
+///<returns> Nothing. </returns>
+void ClientSeatPolicy::sendGameOver(int pointsTotal)
+{
+	SeatRequest request = ClientSeatPolicy::makeRequest(SeatRequest::Type::GAME_OVER, std::vector<Card>(), 0);
+	request.pointsTotal = pointsTotal;
+	m_send(request);
+}
+
+///<summary> Getter for the number of answers that were dropped for being illegal or arriving when no answer was wanted. </summary>
+///<returns> Number of rejected replies. </returns>
+inline int ClientSeatPolicy::getRejectedReplies()
+{
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_rejectedReplies;
+}
+
+///<summary>
+///Checks the client's answer for the current decision, if one has arrived. An illegal answer is dropped and the request
+///is marked as not sent, so the caller sends it again.
+///NOTE: m_mutex must be held by the caller.
+///</summary>
+///<param name="allowedCards"> Bit set of the cards the answer may use. </param>
+///<param name="numCards"> Number of cards the answer must hold. </param>
+///<returns> True if a legal answer is waiting to be handed over, otherwise false. </returns>
+bool ClientSeatPolicy::checkReply(uint64_t allowedCards, int numCards)
+{
+	if (m_isAccepted)
+	{
+		return true;
+	}
+	if (!m_hasReply)
+	{
+		return false;
+	}
+	m_hasReply = false;
+	if (BitHand::countBits(m_replyCards) == numCards && (m_replyCards & ~allowedCards) == 0)
+	{
+		m_isAccepted = true;
+		return true;
+	}
+	m_rejectedReplies++;
+	m_isRequestSent = false;
+	return false;
+}
+
+///<summary> Fills in the parts of a request that every type shares. </summary>
+///<param name="type"> Type of request. </param>
+///<param name="hand"> The seat's current hand. </param>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<returns> The request, with everything else zeroed. </returns>
+SeatRequest ClientSeatPolicy::makeRequest(SeatRequest::Type type, const std::vector<Card> &hand, int numPlayers)
+{
+	SeatRequest request = {};
+	request.type = type;
+	request.tableId = m_tableId;
+	request.seat = m_seat;
+	request.numPlayers = numPlayers;
+	request.hand = BitHand(hand).getBits();
+	return request;
+}
+
+#endif // !CLIENTSEATPOLICY_H
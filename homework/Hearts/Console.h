@@ -0,0 +1,129 @@
+#ifndef CONSOLE_H
+#define CONSOLE_H
+#include <iostream>
+#include <sstream>
+#include <string>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX // keeps Windows.h from defining min() and max() macros that break std::min()
+#endif
+#include <Windows.h>
+#endif
+
+///<summary>
+///Portable replacement for system("cls"). Output is collected in a frame and written to std::cout in a single write by present().
+///beginFrame() starts a new screen: when the frame is presented the terminal is cleared with ANSI escape sequences first.
+///A headless console is a sink that drops everything written to frame(), so callers can write to it without checking.
+///</summary>
+class Console
+{
+public:
+	Console();
+	Console(bool headless);
+	~Console();
+	void setHeadless(bool headless);
+	bool isHeadless() const;
+	void beginFrame();
+	std::ostream &frame();
+	void present();
+
+private:
+	static constexpr const char *CLEAR_SCREEN = "\x1b[2J\x1b[H"; // Clear the screen, then move the cursor to the top left
+
+	bool m_headless;
+	std::ostringstream m_frame;
+	std::ostream m_sink; // Has no buffer, so anything written to it is thrown away
+
+	static void enableEscapeSequences();
+};
+
+///<summary> Constructor for a Console that writes to the terminal. </summary>
+///<returns> Nothing. </returns>
+inline Console::Console() : m_sink(nullptr)
+{
+	m_headless = false;
+	enableEscapeSequences();
+}
+
+///<summary> Constructor for a Console. </summary>
+///<param name="headless"> True for a console that discards everything written to it. </param>
+///<returns> Nothing. </returns>
+inline Console::Console(bool headless) : m_sink(nullptr)
+{
+	m_headless = headless;
+	enableEscapeSequences();
+}
+
+///<summary> Default destructor for Console class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+inline Console::~Console()
+{
+}
+
+///<summary> Setter for whether the console is headless. A frame that has not been presented yet is discarded. </summary>
+///<param name="headless"> True to discard everything written to the console. </param>
+///<returns> Nothing. </returns>
+inline void Console::setHeadless(bool headless)
+{
+	m_headless = headless;
+	m_frame.str("");
+}
+
+///<summary> Getter for whether the console is headless. </summary>
+///<returns> True if everything written to the console is discarded, otherwise false. </returns>
+inline bool Console::isHeadless() const
+{
+	return m_headless;
+}
+
+///<summary> Starts a new screen. Anything not yet presented is discarded and the terminal is cleared when the frame is presented. </summary>
+///<returns> Nothing. </returns>
+inline void Console::beginFrame()
+{
+	m_frame.str("");
+	if (!m_headless)
+	{
+		m_frame << CLEAR_SCREEN;
+	}
+}
+
+///<summary> Getter for the stream that the frame is written to. </summary>
+///<returns> The frame, or a stream that throws everything away when the console is headless. </returns>
+inline std::ostream &Console::frame()
+{
+	if (m_headless)
+	{
+		return m_sink;
+	}
+	return m_frame;
+}
+
+///<summary> Writes everything in the frame to std::cout in a single write, then empties the frame. </summary>
+///<returns> Nothing. </returns>
+inline void Console::present()
+{
+	if (m_headless)
+	{
+		return;
+	}
+	std::string text = m_frame.str();
+	std::cout.write(text.data(), text.size());
+	std::cout.flush();
+	m_frame.str("");
+}
+
+///<summary> Turns on escape sequence handling on Windows consoles, which leave it off by default. Other terminals always have it on. </summary>
+///<returns> Nothing. </returns>
+inline void Console::enableEscapeSequences()
+{
+#ifdef _WIN32
+	HANDLE output = GetStdHandle(STD_OUTPUT_HANDLE);
+	DWORD mode = 0;
+	if (output != INVALID_HANDLE_VALUE && GetConsoleMode(output, &mode))
+	{
+		SetConsoleMode(output, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+	}
+#endif
+}
+
+#endif // !CONSOLE_H
@@ -1,12 +1,12 @@
 #ifndef DECK_H
 #define DECK_H
 #include <vector>
-#include <cstdlib>   // for srand() and rand()
+#include <string>
+#include <cctype>    // for toupper() and isdigit()
 #include <algorithm> // for iter_swap() and min()
-#include <ctime>     // for time()
-#include <Windows.h>
 #include <iomanip>
 #include "Card.h"
+#include "RandomGenerator.h"
 
 ///<summary> 
 ///Deck class that holds Card objects. After creating a Deck object, it will be initialized as a 52 card deck with 4 suits (Clubs, Diamonds, Heart, Spades), 13 cards each 
@@ -15,35 +15,53 @@ class Deck
 {
 public:
 	Deck();
+	Deck(unsigned int seed);
 	~Deck();
+	void setSeed(unsigned int seed);
 	void shuffle();
+	template <class T> static void shuffleItems(T *items, int numItems, RandomGenerator &generator);
 	std::vector<std::vector<Card>> deal(int numHands, int handSize);
+	void dealSorted(int numHands, int handSize, std::vector<std::vector<Card>> &hands);
 	static void sort(std::vector<Card> &hand);
 	void removeOneDeckCard(Card &card);
+	int getCardOrder(uint8_t cardIndexes[]) const;
+	void setCardOrder(const uint8_t cardIndexes[], int numCards);
+	void getGeneratorState(uint64_t state[4]) const;
+	void setGeneratorState(const uint64_t state[4]);
 
 	// Static Functions
-	static int findPositionOfCard(std::vector<Card> &cards, Card &card);
-	static bool isCardStringValid(std::string cardStr);
-	static bool isCardInCollection(std::vector<Card> &cards, Card &card);
-	static bool isCardInCollection(std::vector<Card> &cards, std::string cardStr);
-	static Card convertCardStrToCard(std::string cardStr);
-	static void removeCard(std::vector<Card> &cards, Card &card);
-	static bool hasOneCardOfSuitType(std::vector<Card> &cards, Card::Suit suit);
+	static int findPositionOfCard(const std::vector<Card> &cards, const Card &card);
+	static bool isCardStringValid(const std::string &cardStr);
+	static bool isCardInCollection(const std::vector<Card> &cards, const Card &card);
+	static bool isCardInCollection(const std::vector<Card> &cards, const std::string &cardStr);
+	static Card convertCardStrToCard(const std::string &cardStr);
+	static void removeCard(std::vector<Card> &cards, const Card &card);
+	static bool hasOneCardOfSuitType(const std::vector<Card> &cards, Card::Suit suit);
 
 private:
+	static const int DECK_SIZE = 52;
 	std::vector<Card> m_cards;
+	RandomGenerator m_generator;
 	void initialize();
 	static void mergeSort(std::vector<Card> &hand);
 	static void mergeCollection(std::vector<Card> &hand, int leftIndex, int midIndex, int rightIndex, std::vector<Card> &temp);
 };
 
-///<summary> Constructor for Deck object that sets up the cards in the deck. </summary>
+///<summary> Constructor for Deck object that sets up the cards in the deck. The shuffle generator is seeded from std::random_device. </summary>
 ///<returns> Nothing. </returns>
 Deck::Deck()
 {
 	this->initialize();
 }
 
+///<summary> Constructor for Deck object that sets up the cards in the deck with a seeded shuffle generator. </summary>
+///<param name="seed"> Seed for the deck's own random number generator. The same seed always gives the same shuffles. </param>
+///<returns> Nothing. </returns>
+Deck::Deck(unsigned int seed) : m_generator(seed)
+{
+	this->initialize();
+}
+
 ///<summary> Default destructor for Deck class. No special actions taken. </summary>
 ///<returns> Nothing. </returns>
 Deck::~Deck()
@@ -64,18 +82,42 @@ void Deck::initialize()
 	}
 }
 
-///<summary> Shuffle the Deck object by using a Fisher-Yates shuffle. All cards moved to random position. </summary>
+///<summary> Reseeds the deck's random number generator so the following shuffles can be reproduced. </summary>
+///<param name="seed"> Seed for the generator. </param>
+///<returns> Nothing. </returns>
+inline void Deck::setSeed(unsigned int seed)
+{
+	m_generator.seed(seed);
+}
+
+///<summary> 
+///Shuffle the Deck object by using a Fisher-Yates shuffle. All cards moved to random position.
+///Each Deck owns its generator, so decks in different threads never share random state.
+///Positions are drawn with RandomGenerator::nextBounded(), so every permutation is equally likely.
+///</summary>
 ///<returns> Nothing. </returns>
 void Deck::shuffle()
 {
-	int deckSize = m_cards.size();
-	srand(time(0));
+	Deck::shuffleItems(m_cards.data(), m_cards.size(), m_generator);
+}
+
+///<summary>
+///The Fisher-Yates shuffle used by shuffle(), for any array. Lets the shuffle quality tests run the same code as the deck
+///on plain arrays of any size without building a Deck for each shuffle.
+///</summary>
+///<param name="items"> Array to shuffle in place. </param>
+///<param name="numItems"> Number of items in the array. </param>
+///<param name="generator"> Generator to draw positions from. </param>
+///<returns> Nothing. </returns>
+template <class T>
+void Deck::shuffleItems(T *items, int numItems, RandomGenerator &generator)
+{
 	int random;
 	// Could use std::random_shuffle, but we can implement Fisher-Yates shuffle
-	for (int i = deckSize - 1; i > 0; i--)
+	for (int i = numItems - 1; i > 0; i--)
 	{
-		random = rand() % deckSize;
-		iter_swap(m_cards.begin() + i, m_cards.begin() + random);
+		random = generator.nextBounded(i + 1);
+		std::iter_swap(items + i, items + random);
 	}
 }
 
@@ -100,6 +142,40 @@ std::vector<std::vector<Card>> Deck::deal(int numHands, int handSize)
 	return handsCollection;
 }
 
+///<summary>
+///Deals hands of cards of a specified size, already sorted, into vectors that are reused from call to call.
+///There are only 52 different cards, so instead of sorting each hand this records which hand every card went to
+///and then walks the cards in sorted order, adding each one to its hand (a counting sort).
+///</summary>
+///<param name="numHands"> Number of hands to be dealt. </param>
+///<param name="handSize"> Size of each hand dealt. </param>
+///<param name="hands"> Filled with the hands dealt, each sorted from lowest to highest. Existing vectors are cleared and keep their memory. </param>
+///<returns> Nothing. </returns>
+void Deck::dealSorted(int numHands, int handSize, std::vector<std::vector<Card>> &hands)
+{
+	int owner[DECK_SIZE];
+	std::fill(owner, owner + DECK_SIZE, -1);
+	int numCardsDealt = numHands * handSize;
+	for (int i = 0; i < numCardsDealt; i++)
+	{
+		owner[m_cards.at(i).getIndex()] = i / handSize;
+	}
+
+	hands.resize(numHands);
+	for (int i = 0; i < numHands; i++)
+	{
+		hands.at(i).clear();
+		hands.at(i).reserve(handSize);
+	}
+	for (int index = 0; index < DECK_SIZE; index++)
+	{
+		if (owner[index] != -1)
+		{
+			hands.at(owner[index]).push_back(Card(index % 13, static_cast<Card::Suit>(index / 13)));
+		}
+	}
+}
+
 ///<summary>
 ///Sorts a given hand of Card objects in order based on suit and card value.
 ///Suit priority from lowest to highest: Clubs, Diamonds, Hearts, Spades
@@ -123,6 +199,51 @@ inline void Deck::removeOneDeckCard(Card &card)
 	Deck::removeCard(m_cards, card);
 }
 
+///<summary>
+///Gets the order of the cards in the deck. Each shuffle moves the cards from where the last one left them, so this and the
+///generator state are both needed to reproduce the deals that follow.
+///</summary>
+///<param name="cardIndexes"> Filled with the index (suit * 13 + number) of each card in order. Must have room for 52. </param>
+///<returns> Number of cards in the deck. </returns>
+inline int Deck::getCardOrder(uint8_t cardIndexes[]) const
+{
+	int numCards = m_cards.size();
+	for (int i = 0; i < numCards; i++)
+	{
+		cardIndexes[i] = static_cast<uint8_t>(m_cards.at(i).getIndex());
+	}
+	return numCards;
+}
+
+///<summary> Puts the cards in the deck back in an order taken with getCardOrder(). </summary>
+///<param name="cardIndexes"> Index (suit * 13 + number) of each card in order, each 0 to 51. </param>
+///<param name="numCards"> Number of cards in the deck. </param>
+///<returns> Nothing. </returns>
+inline void Deck::setCardOrder(const uint8_t cardIndexes[], int numCards)
+{
+	m_cards.clear();
+	for (int i = 0; i < numCards; i++)
+	{
+		m_cards.push_back(Card(cardIndexes[i] % 13, static_cast<Card::Suit>(cardIndexes[i] / 13)));
+	}
+}
+
+///<summary> Copies out the state of the deck's random number generator. </summary>
+///<param name="state"> Filled with the four words of the generator's state. </param>
+///<returns> Nothing. </returns>
+inline void Deck::getGeneratorState(uint64_t state[4]) const
+{
+	m_generator.getState(state);
+}
+
+///<summary> Puts back a generator state copied out with getGeneratorState(), so the shuffles from that point repeat. </summary>
+///<param name="state"> The four words of the generator's state. </param>
+///<returns> Nothing. </returns>
+inline void Deck::setGeneratorState(const uint64_t state[4])
+{
+	m_generator.setState(state);
+}
+
 ///<summary>
 ///Finds the position of a given card in a vector of cards.
 ///NOTE: Assumes the provided vector is sorted from least to greatest.
@@ -130,7 +251,7 @@ inline void Deck::removeOneDeckCard(Card &card)
 ///<param name="cards"> Vector of cards to search through. NOTE: Assumes the provided vector is sorted from least to greatest.</param>
 ///<param name="card"> Card object to be found. </param>
 ///<returns> The integer position of the given card in the provided vector. </returns>
-int Deck::findPositionOfCard(std::vector<Card>& cards, Card &card)
+int Deck::findPositionOfCard(const std::vector<Card>& cards, const Card &card)
 {
 	// binary search
 	int leftIndex = 0;
@@ -164,7 +285,7 @@ int Deck::findPositionOfCard(std::vector<Card>& cards, Card &card)
 ///</summary>
 ///<param name="cardStr"> String representing Card object. </param>
 ///<returns> True if string represents a valid Card, otherwise false. </returns>
-bool Deck::isCardStringValid(std::string cardStr)
+bool Deck::isCardStringValid(const std::string &cardStr)
 {
 	bool result = true;
 	if (cardStr.length() != 2 || cardStr.empty())
@@ -199,7 +320,7 @@ bool Deck::isCardStringValid(std::string cardStr)
 ///<param name="cards"> Vector of cards where one is removed. NOTE: Assumes vector is sorted from least to greatest. </param>
 ///<param name="card"> Card object to find. </param>
 ///<returns> True if the given card is present in the vector provided, otherwise false. </returns>
-bool Deck::isCardInCollection(std::vector<Card> &cards, Card &card)
+bool Deck::isCardInCollection(const std::vector<Card> &cards, const Card &card)
 {
 	if (Deck::findPositionOfCard(cards, card) != -1)
 	{
@@ -217,7 +338,7 @@ bool Deck::isCardInCollection(std::vector<Card> &cards, Card &card)
 ///<param name="cards"> Vector of cards where one is removed. NOTE: Assumes vector is sorted from least to greatest. </param>
 ///<param name="cardStr"> String representing Card object to find. </param>
 ///<returns> True if the given card is present in the vector provided, otherwise false. </returns>
-bool Deck::isCardInCollection(std::vector<Card> &cards, std::string cardStr)
+bool Deck::isCardInCollection(const std::vector<Card> &cards, const std::string &cardStr)
 {
 	return isCardInCollection(cards, Deck::convertCardStrToCard(cardStr));
 }
@@ -229,7 +350,7 @@ bool Deck::isCardInCollection(std::vector<Card> &cards, std::string cardStr)
 ///</summary>
 ///<param name="cardStr"> String representing Card object. </param>
 ///<returns> A Card object. </returns>
-Card Deck::convertCardStrToCard(std::string cardStr)
+Card Deck::convertCardStrToCard(const std::string &cardStr)
 {
 	char firstChar = cardStr.at(0);
 	char secondChar = cardStr.at(1);
@@ -297,7 +418,7 @@ Card Deck::convertCardStrToCard(std::string cardStr)
 ///<param name="cards"> Vector of cards where one is removed. NOTE: Assumes vector is sorted from least to greatest. </param>
 ///<param name="card"> Card object to be removed from the vector. </param>
 ///<returns> Nothing. </returns>
-inline void Deck::removeCard(std::vector<Card> &cards, Card &card)
+inline void Deck::removeCard(std::vector<Card> &cards, const Card &card)
 {
 	int pos = Deck::findPositionOfCard(cards, card);
 	cards.erase(cards.begin() + pos);
@@ -309,10 +430,10 @@ inline void Deck::removeCard(std::vector<Card> &cards, Card &card)
 ///<param name="cards"> Vector of cards to search through.</param>
 ///<param name="suit"> Suit of card to search for in vector. </param>
 ///<returns> True if the given vector has at least one card of the given suit, otherwise false. </returns>
-inline bool Deck::hasOneCardOfSuitType(std::vector<Card>& cards, Card::Suit suit)
+inline bool Deck::hasOneCardOfSuitType(const std::vector<Card>& cards, Card::Suit suit)
 {
 	bool result = false;
-	for (Card &card : cards)
+	for (const Card &card : cards)
 	{
 		if (card.getSuit() == suit)
 		{
@@ -339,8 +460,8 @@ void Deck::mergeSort(std::vector<Card> &hand)
 		{
 			int leftStart = i;
 			// Very important to use min here, otherwise odd numbered collections cannot be sorted appropriately
-			int mid = min(i + width, n); // min() from algorithm library
-			int rightEnd = min(i + 2 * width, n);
+			int mid = std::min(i + width, n); // min() from algorithm library
+			int rightEnd = std::min(i + 2 * width, n);
 			mergeCollection(hand, leftStart, mid, rightEnd, temp);
 		}
 		// Copy temporary vector back into our final copy
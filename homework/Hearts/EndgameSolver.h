@@ -0,0 +1,425 @@
+#ifndef ENDGAMESOLVER_H
+#define ENDGAMESOLVER_H
+#include <vector>
+#include <unordered_map>
+#include <climits>
+#include <cstdint>
+#include "Card.h"
+#include "BitHand.h"
+#include "TrickState.h"
+#include "HeartsGame.h"
+#include "TrickScorer.h"
+
+///<summary>
+///Outcome of an endgame when every player plays perfectly.
+///</summary>
+struct EndgameResult
+{
+	std::vector<int> points;	// Points each player ends the round with, after shooting the moon is applied
+	Card bestCard;				// Best card for the player about to play
+	long long nodesSearched;
+};
+
+///<summary>
+///Solves the end of a round of Hearts exactly when every hand is known (double dummy).
+///Uses max^n search: every player picks the card that leaves them with the fewest points at the end of the round,
+///assuming everyone after them does the same. Positions at the start of a trick are stored in a transposition table
+///keyed on every player's remaining cards, so the same position reached by playing tricks in a different order is only solved once.
+///Two cheap cuts keep the search small: cards next to each other in a suit with the same point value are the same move,
+///and a player stops looking once a card reaches the fewest points they could possibly end with.
+///</summary>
+class EndgameSolver
+{
+public:
+	static const int MAX_PLAYERS = 5;
+
+	EndgameSolver();
+	~EndgameSolver();
+	EndgameResult solve(const std::vector<BitHand> &hands, const std::vector<int> &pointsThisRound, const std::vector<Card> &trickCards, int leader, bool heartsBroken);
+	void clearTable();
+	int getTableSize();
+
+private:
+	static const int MAX_TABLE_SIZE = 1 << 20;
+	static const int NO_SCORER = MAX_PLAYERS;
+	static const int MANY_SCORERS = MAX_PLAYERS + 1;
+	static const uint64_t QUEEN_OF_SPADES_BIT = uint64_t(1) << (3 * 13 + 10);
+	static const uint64_t HEARTS_BITS = BitHand::SUIT_BITS << (2 * 13);
+
+	///<summary> Compact copy of the round being solved. Cards are BitHand bit positions. </summary>
+	struct SolverState
+	{
+		int numPlayers;
+		uint64_t hands[MAX_PLAYERS];
+		int points[MAX_PLAYERS];
+		uint8_t trickCards[MAX_PLAYERS];
+		int trickSize;
+		int leader;
+		bool heartsBroken;
+	};
+
+	///<summary>
+	///Position at the start of a trick. Points already taken only matter for shooting the moon,
+	///so instead of the points the key holds who has taken any: nobody, a single player, or more than one.
+	///</summary>
+	struct TableKey
+	{
+		uint64_t hands[MAX_PLAYERS];
+		int leader;
+		int flags; // scorer code * 2 + hearts broken
+
+		bool operator==(const TableKey &other) const;
+	};
+
+	///<summary> Hash for TableKey used by the transposition table. </summary>
+	struct TableKeyHash
+	{
+		size_t operator()(const TableKey &key) const;
+	};
+
+	///<summary> Points each player takes from a position to the end of the round, and the card to play. </summary>
+	struct TableEntry
+	{
+		int points[MAX_PLAYERS];
+		int bestCard;
+	};
+
+	std::unordered_map<TableKey, TableEntry, TableKeyHash> m_table;
+	long long m_nodesSearched;
+
+	int search(const SolverState &state, int finalPoints[]);
+	static void playCard(SolverState &state, int cardIndex);
+	static uint64_t candidateMoves(const SolverState &state);
+	static int scorerCode(const SolverState &state);
+	static int adjustedPoints(const int points[], int numPlayers, int playerIndex);
+	static int cardPoints(int cardIndex);
+};
+
+///<summary> Constructor for EndgameSolver object. </summary>
+///<returns> Nothing. </returns>
+EndgameSolver::EndgameSolver()
+{
+	m_nodesSearched = 0;
+}
+
+///<summary> Default destructor for EndgameSolver class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+EndgameSolver::~EndgameSolver()
+{
+}
+
+///<summary>
+///Finds the outcome of the rest of the round with perfect play from every player.
+///Entries in the transposition table stay valid between calls, so solving positions from the same deal gets faster.
+///</summary>
+///<param name="hands"> Cards left in each player's hand. </param>
+///<param name="pointsThisRound"> Points each player has taken so far this round. </param>
+///<param name="trickCards"> Cards played so far in the trick in progress, in the order they were played. May be empty. </param>
+///<param name="leader"> Index of the player who led the trick in progress (or leads the next trick). </param>
+///<param name="heartsBroken"> Whether Hearts have been played this round. </param>
+///<returns> The final points for each player and the best card for the player about to play. </returns>
+EndgameResult EndgameSolver::solve(const std::vector<BitHand> &hands, const std::vector<int> &pointsThisRound, const std::vector<Card> &trickCards, int leader, bool heartsBroken)
+{
+	SolverState state;
+	int finalPoints[MAX_PLAYERS];
+	state.numPlayers = hands.size();
+	for (int p = 0; p < state.numPlayers; p++)
+	{
+		state.hands[p] = hands.at(p).getBits();
+		state.points[p] = pointsThisRound.at(p);
+	}
+	state.trickSize = trickCards.size();
+	for (int i = 0; i < state.trickSize; i++)
+	{
+		state.trickCards[i] = BitHand::cardIndex(trickCards.at(i));
+	}
+	state.leader = leader;
+	state.heartsBroken = heartsBroken;
+
+	if (m_table.size() > MAX_TABLE_SIZE)
+	{
+		m_table.clear();
+	}
+	m_nodesSearched = 0;
+	int bestCard = search(state, finalPoints);
+
+	EndgameResult result;
+	for (int p = 0; p < state.numPlayers; p++)
+	{
+		result.points.push_back(adjustedPoints(finalPoints, state.numPlayers, p));
+	}
+	if (bestCard != -1)
+	{
+		result.bestCard = BitHand::indexToCard(bestCard);
+	}
+	result.nodesSearched = m_nodesSearched;
+	return result;
+}
+
+///<summary> Removes every position from the transposition table. </summary>
+///<returns> Nothing. </returns>
+inline void EndgameSolver::clearTable()
+{
+	m_table.clear();
+}
+
+///<summary> Getter for the number of positions in the transposition table. </summary>
+///<returns> Number of positions stored. </returns>
+inline int EndgameSolver::getTableSize()
+{
+	return m_table.size();
+}
+
+///<summary> Searches every line of play from a position. </summary>
+///<param name="state"> Position to search from. </param>
+///<param name="finalPoints"> Filled with the raw points each player has at the end of the round under best play. </param>
+///<returns> BitHand position of the best card for the player about to play, or -1 when the round is over. </returns>
+int EndgameSolver::search(const SolverState &state, int finalPoints[])
+{
+	int numPlayers = state.numPlayers;
+	int player = (state.leader + state.trickSize) % numPlayers;
+	m_nodesSearched++;
+	if (state.trickSize == 0 && state.hands[player] == 0)
+	{
+		for (int p = 0; p < numPlayers; p++)
+		{
+			finalPoints[p] = state.points[p];
+		}
+		return -1;
+	}
+
+	// Only positions between tricks go in the table, the trick in progress would have to be part of the key otherwise
+	TableKey key;
+	int scorers = scorerCode(state);
+	if (state.trickSize == 0)
+	{
+		for (int p = 0; p < MAX_PLAYERS; p++)
+		{
+			key.hands[p] = (p < numPlayers) ? state.hands[p] : 0;
+		}
+		key.leader = state.leader;
+		key.flags = scorers * 2 + (state.heartsBroken ? 1 : 0);
+		auto found = m_table.find(key);
+		if (found != m_table.end())
+		{
+			for (int p = 0; p < numPlayers; p++)
+			{
+				finalPoints[p] = state.points[p] + found->second.points[p];
+			}
+			return found->second.bestCard;
+		}
+	}
+
+	// Unless somebody can still shoot the moon, a player cannot end with fewer points than they already have
+	int fewestPossible = (scorers == MANY_SCORERS) ? state.points[player] : 0;
+	int bestCard = -1;
+	int bestValue = INT_MAX;
+	int childPoints[MAX_PLAYERS];
+	for (uint64_t moves = candidateMoves(state); moves != 0; moves &= moves - 1)
+	{
+		int card = BitHand::lowestBitIndex(moves);
+		SolverState child = state;
+		playCard(child, card);
+		search(child, childPoints);
+		int value = adjustedPoints(childPoints, numPlayers, player);
+		if (value < bestValue)
+		{
+			bestValue = value;
+			bestCard = card;
+			for (int p = 0; p < numPlayers; p++)
+			{
+				finalPoints[p] = childPoints[p];
+			}
+			if (value <= fewestPossible)
+			{
+				break;
+			}
+		}
+	}
+
+	if (state.trickSize == 0)
+	{
+		TableEntry entry;
+		for (int p = 0; p < numPlayers; p++)
+		{
+			entry.points[p] = finalPoints[p] - state.points[p];
+		}
+		entry.bestCard = bestCard;
+		m_table[key] = entry;
+	}
+	return bestCard;
+}
+
+///<summary> Plays a card for the player whose turn it is, scoring the trick when it is complete. </summary>
+///<param name="state"> Position to play the card in. </param>
+///<param name="cardIndex"> BitHand position of the card. </param>
+///<returns> Nothing. </returns>
+void EndgameSolver::playCard(SolverState &state, int cardIndex)
+{
+	int player = (state.leader + state.trickSize) % state.numPlayers;
+	state.hands[player] &= ~(uint64_t(1) << cardIndex);
+	if (cardIndex / BitHand::SUIT_SIZE == static_cast<int>(Card::Suit::HEARTS))
+	{
+		state.heartsBroken = true;
+	}
+	state.trickCards[state.trickSize++] = static_cast<uint8_t>(cardIndex);
+
+	if (state.trickSize == state.numPlayers)
+	{
+		int winningPos = TrickScorer::findWinningPosition(state.trickCards, state.numPlayers);
+		int winner = (state.leader + winningPos) % state.numPlayers;
+		state.points[winner] += TrickScorer::tallyPoints(state.trickCards, state.numPlayers);
+		state.leader = winner;
+		state.trickSize = 0;
+	}
+}
+
+///<summary>
+///Finds the legal cards worth trying for the player whose turn it is.
+///When two legal cards are next to each other in a suit (counting only cards still in a hand or in the current trick)
+///and are worth the same points, playing either one leads to the same result, so only the lower one is kept.
+///</summary>
+///<param name="state"> Position to find moves in. </param>
+///<returns> Bit set of the cards to try. </returns>
+uint64_t EndgameSolver::candidateMoves(const SolverState &state)
+{
+	int player = (state.leader + state.trickSize) % state.numPlayers;
+	TrickState trickState;
+	trickState.isFirstTrickOfRound = false;
+	trickState.isLeadingCard = state.trickSize == 0;
+	trickState.canPlayHearts = state.heartsBroken;
+	trickState.canLeadQofS = true;
+	trickState.leadingCardSuit = static_cast<Card::Suit>(state.trickSize > 0 ? state.trickCards[0] / BitHand::SUIT_SIZE : 0);
+	uint64_t legal = HeartsGame::legalMoves(BitHand(state.hands[player]), trickState).getBits();
+
+	uint64_t inPlay = 0;
+	for (int p = 0; p < state.numPlayers; p++)
+	{
+		inPlay |= state.hands[p];
+	}
+	for (int i = 0; i < state.trickSize; i++)
+	{
+		inPlay |= uint64_t(1) << state.trickCards[i];
+	}
+
+	uint64_t moves = legal;
+	for (uint64_t bits = legal; bits != 0; bits &= bits - 1)
+	{
+		int card = BitHand::lowestBitIndex(bits);
+		uint64_t suitBits = BitHand::SUIT_BITS << (card / BitHand::SUIT_SIZE * BitHand::SUIT_SIZE);
+		uint64_t lower = inPlay & suitBits & ((uint64_t(1) << card) - 1);
+		if (lower != 0)
+		{
+			int below = BitHand::highestBitIndex(lower);
+			if ((legal & (uint64_t(1) << below)) && cardPoints(below) == cardPoints(card))
+			{
+				moves &= ~(uint64_t(1) << card);
+			}
+		}
+	}
+	return moves;
+}
+
+///<summary>
+///Sums up who has taken points this round. When one player or nobody has points, the points already taken are fixed by
+///the cards left in the hands (every point card not in a hand went to that player), so the code and the hands together
+///say everything about the points that matters for what happens next.
+///</summary>
+///<param name="state"> Position at the start of a trick. </param>
+///<returns> Index of the only player with points, NO_SCORER, or MANY_SCORERS. </returns>
+int EndgameSolver::scorerCode(const SolverState &state)
+{
+	int code = NO_SCORER;
+	for (int p = 0; p < state.numPlayers; p++)
+	{
+		if (state.points[p] > 0)
+		{
+			code = (code == NO_SCORER) ? p : MANY_SCORERS;
+		}
+	}
+	return code;
+}
+
+///<summary> Gets a player's points at the end of a round once shooting the moon is applied. </summary>
+///<param name="points"> Raw points each player took this round. </param>
+///<param name="numPlayers"> Number of players. </param>
+///<param name="playerIndex"> Player to get the points for. </param>
+///<returns> 0 if the player shot the moon, 26 if someone else did, otherwise their raw points. </returns>
+int EndgameSolver::adjustedPoints(const int points[], int numPlayers, int playerIndex)
+{
+	for (int p = 0; p < numPlayers; p++)
+	{
+		if (points[p] == 26)
+		{
+			return (p == playerIndex) ? 0 : 26;
+		}
+	}
+	return points[playerIndex];
+}
+
+///<summary> Gets the points a card is worth. </summary>
+///<param name="cardIndex"> BitHand position of the card. </param>
+///<returns> 1 for a Heart, 13 for the Queen of Spades, otherwise 0. </returns>
+inline int EndgameSolver::cardPoints(int cardIndex)
+{
+	uint64_t bit = uint64_t(1) << cardIndex;
+	return (bit & HEARTS_BITS) ? 1 : ((bit & QUEEN_OF_SPADES_BIT) ? 13 : 0);
+}
+
+///<summary> Compares two positions. </summary>
+///<param name="other"> Position to compare with. </param>
+///<returns> True if both positions are the same, otherwise false. </returns>
+inline bool EndgameSolver::TableKey::operator==(const TableKey &other) const
+{
+	for (int p = 0; p < MAX_PLAYERS; p++)
+	{
+		if (hands[p] != other.hands[p])
+		{
+			return false;
+		}
+	}
+	return leader == other.leader && flags == other.flags;
+}
+
+///<summary> Mixes every field of a position into one hash value. </summary>
+///<param name="key"> Position to hash. </param>
+///<returns> The hash value. </returns>
+inline size_t EndgameSolver::TableKeyHash::operator()(const TableKey &key) const
+{
+	uint64_t hash = static_cast<uint64_t>(key.leader * 16 + key.flags);
+	for (int p = 0; p < MAX_PLAYERS; p++)
+	{
+		hash = (hash ^ key.hands[p]) * 0x9E3779B97F4A7C15ULL;
+		hash ^= hash >> 29;
+	}
+	return static_cast<size_t>(hash);
+}
+
+///<summary>
+///Solves the rest of the round in progress exactly, with every hand known, using the hands, trick and leader from getState().
+///Meant for the last few tricks of a round, since the search grows quickly with the number of cards left.
+///Scores with the standard rules, so rule bonuses such as Omnibus Hearts' Jack of Diamonds are not counted.
+///NOTE: Assumes the round is in progress, the cards have been passed, and the first trick has been played.
+///</summary>
+///<param name="solver"> Solver to use. Its transposition table is kept, so solving later positions of the same deal is faster. </param>
+///<returns> The points each player ends the round with and the best card for the player about to play. </returns>
+template <class Rules>
+EndgameResult BasicHeartsGame<Rules>::solveEndgame(EndgameSolver &solver)
+{
+	HeartsState state = BasicHeartsGame::getState();
+	std::vector<BitHand> hands;
+	std::vector<int> pointsThisRound;
+	std::vector<Card> trickCards;
+	for (int p = 0; p < state.numPlayers; p++)
+	{
+		hands.push_back(BitHand(state.hands[p]));
+		pointsThisRound.push_back(state.pointsThisRound[p]);
+	}
+	for (int i = 0; i < state.trickSize; i++)
+	{
+		trickCards.push_back(BitHand::indexToCard(state.trickCards[i]));
+	}
+	return solver.solve(hands, pointsThisRound, trickCards, state.trickLeader, state.canPlayHearts);
+}
+
+#endif // !ENDGAMESOLVER_H
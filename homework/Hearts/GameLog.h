@@ -0,0 +1,706 @@
+#ifndef GAMELOG_H
+#define GAMELOG_H
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstring> // for memcmp()
+#include "Card.h"
+#include "BitHand.h"
+#include "TrickScorer.h"
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX // keeps Windows.h from defining min() and max() macros that break std::min()
+#endif
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+///<summary>
+///Everything needed to replay one round of Hearts. Cards are BitHand positions (suit * 13 + number).
+///</summary>
+struct RoundRecord
+{
+	static const int MAX_PLAYERS = 5;
+	static const int MAX_HAND_SIZE = 17;
+	static const int NOT_DEALT = -1;
+
+	int numPlayers;
+	bool isNewGame;								// First round of a game, so every player's total starts from zero
+	int passOffset;								// Each player passes to the player this many seats after them, 0 for no passing
+	int dealOwners[52];							// Player dealt each card, or NOT_DEALT
+	int passedCards[MAX_PLAYERS][3];			// Cards each player passed
+	int trickCards[MAX_HAND_SIZE * MAX_PLAYERS];// Every card played, in the order they were played
+	int points[MAX_PLAYERS];					// Points each player took this round, before shooting the moon is applied
+};
+
+///<summary>
+///Position part way through a replayed round.
+///</summary>
+struct ReplayState
+{
+	int numPlayers;
+	BitHand hands[RoundRecord::MAX_PLAYERS];
+	int points[RoundRecord::MAX_PLAYERS];
+	int leader;			// Player who leads the next trick
+	bool heartsBroken;
+	int tricksPlayed;
+};
+
+///<summary>
+///The binary game log format. Every round takes the same number of bytes for a given number of players,
+///so round N of a file is found by arithmetic and files can be read straight out of memory.
+///File header (8 bytes): "HRTL", version, number of players, two unused bytes. Then for every round:
+///	26 bytes	- player dealt each card, 4 bits per card (two cards per byte, even card in the low bits), 15 when not dealt
+///	1 byte		- pass offset in the low 3 bits, top bit set on the first round of a game
+///	3 * n bytes	- cards passed by each player
+///	52 / n * n	- every card played, one byte each, in the order they were played. The leader of each trick is not stored:
+///				  the first trick is led by whoever holds its first card and every other trick by the winner of the one before
+///	n bytes		- points taken by each player
+///With 4 players a round is 95 bytes, about 7 bytes a trick.
+///</summary>
+class GameLogFormat
+{
+public:
+	static const int HEADER_SIZE = 8;
+	static const int VERSION = 1;
+	static const int DEAL_BYTES = 26;
+	static const int NOT_DEALT_CODE = 15;
+
+	static int getHandSize(int numPlayers);
+	static int getRecordSize(int numPlayers);
+	static void encode(const RoundRecord &record, uint8_t *bytes);
+	static bool decode(const uint8_t *bytes, int numPlayers, RoundRecord &record);
+	static bool isValidHeader(const uint8_t *bytes);
+	static bool isValidRecord(const RoundRecord &record);
+};
+
+///<summary>
+///Writes rounds to a game log file. HeartsGame fills in the round as it is played through the record functions.
+///Rounds are collected in memory and written in large blocks. A writer must only be used by one game at a time.
+///If a block cannot be written, for example because the disk is full, the writer remembers it and close() reports it.
+///</summary>
+class GameLogWriter
+{
+public:
+	GameLogWriter();
+	~GameLogWriter();
+	bool open(const std::string &fileName, int numPlayers);
+	bool close();
+	bool isOpen();
+	bool hasFailed();
+	void beginRound(bool isNewGame, int passOffset);
+	void recordHand(int playerIndex, BitHand hand);
+	void recordPass(int playerIndex, const std::vector<Card> &cards);
+	void recordTrick(const std::vector<Card> &trickCards);
+	void endRound(const std::vector<int> &points);
+	long long getRoundsWritten();
+
+private:
+	static const int BUFFER_SIZE = 1 << 16;
+
+	std::ofstream m_file;
+	int m_numPlayers;
+	RoundRecord m_record;
+	int m_numCardsPlayed;
+	std::vector<uint8_t> m_buffer;
+	long long m_roundsWritten;
+	bool m_hasFailed;
+
+	bool flush();
+};
+
+///<summary>
+///Reads a game log file by mapping it into memory, so even very large logs are read at the speed of the page cache
+///and only the parts actually touched are loaded. Rounds can be read in any order.
+///</summary>
+class GameLogReader
+{
+public:
+	GameLogReader();
+	~GameLogReader();
+	bool open(const std::string &fileName);
+	void close();
+	int getNumPlayers();
+	long long getNumRounds();
+	bool getRound(long long roundIndex, RoundRecord &record);
+	static bool replay(const RoundRecord &record, int numTricks, ReplayState &state);
+
+private:
+	const uint8_t *m_data;
+	size_t m_size;
+	int m_numPlayers;
+	int m_recordSize;
+#ifdef _WIN32
+	HANDLE m_file;
+	HANDLE m_mapping;
+#else
+	int m_file;
+#endif
+};
+
+///<summary> Gets the number of cards each player is dealt. </summary>
+///<param name="numPlayers"> Number of players (3-5). </param>
+///<returns> 17, 13 or 10. </returns>
+inline int GameLogFormat::getHandSize(int numPlayers)
+{
+	return 52 / numPlayers;
+}
+
+///<summary> Gets the number of bytes one round takes. </summary>
+///<param name="numPlayers"> Number of players (3-5). </param>
+///<returns> Size of a round in bytes. </returns>
+inline int GameLogFormat::getRecordSize(int numPlayers)
+{
+	return DEAL_BYTES + 1 + 3 * numPlayers + getHandSize(numPlayers) * numPlayers + numPlayers;
+}
+
+///<summary> Packs a round into its fixed size binary form. </summary>
+///<param name="record"> Round to pack. </param>
+///<param name="bytes"> Where to write the round. Must have room for getRecordSize() bytes. </param>
+///<returns> Nothing. </returns>
+void GameLogFormat::encode(const RoundRecord &record, uint8_t *bytes)
+{
+	int numPlayers = record.numPlayers;
+	for (int i = 0; i < DEAL_BYTES; i++)
+	{
+		int low = record.dealOwners[2 * i];
+		int high = record.dealOwners[2 * i + 1];
+		bytes[i] = static_cast<uint8_t>((low == RoundRecord::NOT_DEALT ? NOT_DEALT_CODE : low) | ((high == RoundRecord::NOT_DEALT ? NOT_DEALT_CODE : high) << 4));
+	}
+	bytes += DEAL_BYTES;
+	*bytes++ = static_cast<uint8_t>(record.passOffset | (record.isNewGame ? 0x80 : 0));
+	for (int p = 0; p < numPlayers; p++)
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			*bytes++ = static_cast<uint8_t>(record.passedCards[p][i]);
+		}
+	}
+	int numCards = getHandSize(numPlayers) * numPlayers;
+	for (int i = 0; i < numCards; i++)
+	{
+		*bytes++ = static_cast<uint8_t>(record.trickCards[i]);
+	}
+	for (int p = 0; p < numPlayers; p++)
+	{
+		*bytes++ = static_cast<uint8_t>(record.points[p]);
+	}
+}
+
+///<summary> Unpacks a round from its binary form. The bytes come from a file, so the round is checked before it is used. </summary>
+///<param name="bytes"> Start of the round. </param>
+///<param name="numPlayers"> Number of players in the log. </param>
+///<param name="record"> Filled with the round. </param>
+///<returns> True if the round is one a game could have logged, otherwise false. </returns>
+bool GameLogFormat::decode(const uint8_t *bytes, int numPlayers, RoundRecord &record)
+{
+	record.numPlayers = numPlayers;
+	for (int i = 0; i < DEAL_BYTES; i++)
+	{
+		int low = bytes[i] & 0x0F;
+		int high = bytes[i] >> 4;
+		record.dealOwners[2 * i] = (low == NOT_DEALT_CODE) ? RoundRecord::NOT_DEALT : low;
+		record.dealOwners[2 * i + 1] = (high == NOT_DEALT_CODE) ? RoundRecord::NOT_DEALT : high;
+	}
+	bytes += DEAL_BYTES;
+	record.passOffset = *bytes & 0x07;
+	record.isNewGame = (*bytes & 0x80) != 0;
+	bytes++;
+	for (int p = 0; p < numPlayers; p++)
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			record.passedCards[p][i] = *bytes++;
+		}
+	}
+	int numCards = getHandSize(numPlayers) * numPlayers;
+	for (int i = 0; i < numCards; i++)
+	{
+		record.trickCards[i] = *bytes++;
+	}
+	for (int p = 0; p < numPlayers; p++)
+	{
+		record.points[p] = *bytes++;
+	}
+	return isValidRecord(record);
+}
+
+///<summary> Checks the start of a file for the game log header. </summary>
+///<param name="bytes"> First HEADER_SIZE bytes of the file. </param>
+///<returns> True if the header is a supported game log header, otherwise false. </returns>
+inline bool GameLogFormat::isValidHeader(const uint8_t *bytes)
+{
+	return std::memcmp(bytes, "HRTL", 4) == 0 && bytes[4] == VERSION && bytes[5] >= 3 && bytes[5] <= 5;
+}
+
+///<summary>
+///Checks that a round is one a game could have logged, so replaying it never reads or writes outside its tables:
+///every owner is a player, every card is below 52, each player is dealt a full hand, each player passes three different
+///cards they were dealt, and every dealt card is played exactly once. Whether the cards were played legally is not checked.
+///</summary>
+///<param name="record"> Round to check. </param>
+///<returns> True if the round is valid, otherwise false. </returns>
+bool GameLogFormat::isValidRecord(const RoundRecord &record)
+{
+	int numPlayers = record.numPlayers;
+	if (numPlayers < 3 || numPlayers > RoundRecord::MAX_PLAYERS || record.passOffset < 0 || record.passOffset >= numPlayers)
+	{
+		return false;
+	}
+	int handSize = getHandSize(numPlayers);
+	int handSizes[RoundRecord::MAX_PLAYERS] = {};
+	uint64_t dealt = 0;
+	for (int i = 0; i < 52; i++)
+	{
+		int owner = record.dealOwners[i];
+		if (owner == RoundRecord::NOT_DEALT)
+		{
+			continue;
+		}
+		if (owner < 0 || owner >= numPlayers)
+		{
+			return false;
+		}
+		handSizes[owner]++;
+		dealt |= 1ULL << i;
+	}
+	for (int p = 0; p < numPlayers; p++)
+	{
+		if (handSizes[p] != handSize)
+		{
+			return false;
+		}
+	}
+	if (record.passOffset != 0)
+	{
+		for (int p = 0; p < numPlayers; p++)
+		{
+			uint64_t passed = 0;
+			for (int i = 0; i < 3; i++)
+			{
+				int card = record.passedCards[p][i];
+				if (card < 0 || card >= 52 || record.dealOwners[card] != p || (passed >> card) & 1)
+				{
+					return false;
+				}
+				passed |= 1ULL << card;
+			}
+		}
+	}
+	uint64_t played = 0;
+	for (int i = 0; i < handSize * numPlayers; i++)
+	{
+		int card = record.trickCards[i];
+		if (card < 0 || card >= 52 || !((dealt >> card) & 1) || (played >> card) & 1)
+		{
+			return false;
+		}
+		played |= 1ULL << card;
+	}
+	return true;
+}
+
+///<summary> Constructor for GameLogWriter object. Call open() before recording any rounds. </summary>
+///<returns> Nothing. </returns>
+GameLogWriter::GameLogWriter()
+{
+	m_numPlayers = 0;
+	m_numCardsPlayed = 0;
+	m_roundsWritten = 0;
+	m_hasFailed = false;
+}
+
+///<summary> Destructor for GameLogWriter class. Writes any rounds still in memory. </summary>
+///<returns> Nothing. </returns>
+GameLogWriter::~GameLogWriter()
+{
+	close();
+}
+
+///<summary> Creates a game log file, replacing any file with the same name. </summary>
+///<param name="fileName"> Name of the file to write. </param>
+///<param name="numPlayers"> Number of players in every game that will be logged (3-5). </param>
+///<returns> True if the file was created, otherwise false. </returns>
+bool GameLogWriter::open(const std::string &fileName, int numPlayers)
+{
+	close();
+	m_file.open(fileName, std::ios::binary | std::ios::trunc);
+	if (!m_file)
+	{
+		return false;
+	}
+	m_numPlayers = numPlayers;
+	m_roundsWritten = 0;
+	m_hasFailed = false;
+	m_buffer.clear();
+	m_buffer.reserve(BUFFER_SIZE + GameLogFormat::getRecordSize(numPlayers));
+	uint8_t header[GameLogFormat::HEADER_SIZE] = { 'H', 'R', 'T', 'L', GameLogFormat::VERSION, static_cast<uint8_t>(numPlayers), 0, 0 };
+	m_buffer.insert(m_buffer.end(), header, header + GameLogFormat::HEADER_SIZE);
+	return true;
+}
+
+///<summary> Writes any rounds still in memory and closes the file. </summary>
+///<returns> True if every round since the file was opened was written, otherwise false. </returns>
+bool GameLogWriter::close()
+{
+	if (m_file.is_open())
+	{
+		flush();
+		m_file.close();
+		if (m_file.fail())
+		{
+			m_hasFailed = true;
+		}
+	}
+	return !m_hasFailed;
+}
+
+///<summary> Determines whether the writer has a file open. </summary>
+///<returns> True if a file is open, otherwise false. </returns>
+inline bool GameLogWriter::isOpen()
+{
+	return m_file.is_open();
+}
+
+///<summary> Determines whether writing to the file has failed since it was opened. The rounds after the failure are lost. </summary>
+///<returns> True if a write failed, otherwise false. </returns>
+inline bool GameLogWriter::hasFailed()
+{
+	return m_hasFailed;
+}
+
+///<summary> Starts recording a new round. </summary>
+///<param name="isNewGame"> Whether this is the first round of a game. </param>
+///<param name="passOffset"> Each player passes to the player this many seats after them, 0 for no passing. </param>
+///<returns> Nothing. </returns>
+void GameLogWriter::beginRound(bool isNewGame, int passOffset)
+{
+	m_record.numPlayers = m_numPlayers;
+	m_record.isNewGame = isNewGame;
+	m_record.passOffset = passOffset;
+	for (int i = 0; i < 52; i++)
+	{
+		m_record.dealOwners[i] = RoundRecord::NOT_DEALT;
+	}
+	for (int p = 0; p < RoundRecord::MAX_PLAYERS; p++)
+	{
+		for (int i = 0; i < 3; i++)
+		{
+			m_record.passedCards[p][i] = 0;
+		}
+		m_record.points[p] = 0;
+	}
+	m_numCardsPlayed = 0;
+}
+
+///<summary> Records the cards a player was dealt. </summary>
+///<param name="playerIndex"> Index of the player. </param>
+///<param name="hand"> Cards dealt to the player. </param>
+///<returns> Nothing. </returns>
+void GameLogWriter::recordHand(int playerIndex, BitHand hand)
+{
+	for (uint64_t bits = hand.getBits(); bits != 0; bits &= bits - 1)
+	{
+		m_record.dealOwners[BitHand::lowestBitIndex(bits)] = playerIndex;
+	}
+}
+
+///<summary> Records the cards a player passed. </summary>
+///<param name="playerIndex"> Index of the player. </param>
+///<param name="cards"> The three cards passed. </param>
+///<returns> Nothing. </returns>
+void GameLogWriter::recordPass(int playerIndex, const std::vector<Card> &cards)
+{
+	for (int i = 0; i < 3 && i < static_cast<int>(cards.size()); i++)
+	{
+		m_record.passedCards[playerIndex][i] = cards.at(i).getIndex();
+	}
+}
+
+///<summary> Records the cards of a finished trick. </summary>
+///<param name="trickCards"> Cards in the order they were played. </param>
+///<returns> Nothing. </returns>
+void GameLogWriter::recordTrick(const std::vector<Card> &trickCards)
+{
+	for (const Card &card : trickCards)
+	{
+		m_record.trickCards[m_numCardsPlayed++] = card.getIndex();
+	}
+}
+
+///<summary> Finishes the round and adds it to the log. </summary>
+///<param name="points"> Points each player took this round, before shooting the moon is applied. </param>
+///<returns> Nothing. </returns>
+void GameLogWriter::endRound(const std::vector<int> &points)
+{
+	for (int p = 0; p < m_numPlayers; p++)
+	{
+		m_record.points[p] = points.at(p);
+	}
+	size_t start = m_buffer.size();
+	m_buffer.resize(start + GameLogFormat::getRecordSize(m_numPlayers));
+	GameLogFormat::encode(m_record, m_buffer.data() + start);
+	m_roundsWritten++;
+	if (m_buffer.size() >= BUFFER_SIZE)
+	{
+		flush();
+	}
+}
+
+///<summary> Getter for the number of rounds written since the file was opened. </summary>
+///<returns> Number of rounds. </returns>
+inline long long GameLogWriter::getRoundsWritten()
+{
+	return m_roundsWritten;
+}
+
+///<summary> Writes the rounds collected in memory to the file. A failure is remembered, so close() can report it. </summary>
+///<returns> True if the rounds were written, otherwise false. </returns>
+bool GameLogWriter::flush()
+{
+	m_file.write(reinterpret_cast<const char*>(m_buffer.data()), m_buffer.size());
+	m_file.flush();
+	m_buffer.clear();
+	if (!m_file)
+	{
+		m_hasFailed = true;
+	}
+	return !m_hasFailed;
+}
+
+///<summary> Constructor for GameLogReader object. Call open() before reading any rounds. </summary>
+///<returns> Nothing. </returns>
+GameLogReader::GameLogReader()
+{
+	m_data = nullptr;
+	m_size = 0;
+	m_numPlayers = 0;
+	m_recordSize = 1;
+#ifdef _WIN32
+	m_file = INVALID_HANDLE_VALUE;
+	m_mapping = NULL;
+#else
+	m_file = -1;
+#endif
+}
+
+///<summary> Destructor for GameLogReader class. Unmaps the file. </summary>
+///<returns> Nothing. </returns>
+GameLogReader::~GameLogReader()
+{
+	close();
+}
+
+///<summary> Maps a game log file into memory. </summary>
+///<param name="fileName"> Name of the file to read. </param>
+///<returns> True if the file was opened and is a game log, otherwise false. </returns>
+bool GameLogReader::open(const std::string &fileName)
+{
+	close();
+#ifdef _WIN32
+	m_file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (m_file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+	LARGE_INTEGER fileSize;
+	GetFileSizeEx(m_file, &fileSize);
+	m_size = static_cast<size_t>(fileSize.QuadPart);
+	if (m_size >= GameLogFormat::HEADER_SIZE)
+	{
+		m_mapping = CreateFileMappingA(m_file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (m_mapping != NULL)
+		{
+			m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+		}
+	}
+#else
+	m_file = ::open(fileName.c_str(), O_RDONLY);
+	if (m_file == -1)
+	{
+		return false;
+	}
+	struct stat fileStats;
+	fstat(m_file, &fileStats);
+	m_size = static_cast<size_t>(fileStats.st_size);
+	if (m_size >= GameLogFormat::HEADER_SIZE)
+	{
+		void *data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_file, 0);
+		if (data != MAP_FAILED)
+		{
+			madvise(data, m_size, MADV_SEQUENTIAL);
+			m_data = static_cast<const uint8_t*>(data);
+		}
+	}
+#endif
+	if (m_data == nullptr || !GameLogFormat::isValidHeader(m_data))
+	{
+		close();
+		return false;
+	}
+	m_numPlayers = m_data[5];
+	m_recordSize = GameLogFormat::getRecordSize(m_numPlayers);
+	return true;
+}
+
+///<summary> Unmaps and closes the file. </summary>
+///<returns> Nothing. </returns>
+void GameLogReader::close()
+{
+#ifdef _WIN32
+	if (m_data != nullptr)
+	{
+		UnmapViewOfFile(m_data);
+	}
+	if (m_mapping != NULL)
+	{
+		CloseHandle(m_mapping);
+		m_mapping = NULL;
+	}
+	if (m_file != INVALID_HANDLE_VALUE)
+	{
+		CloseHandle(m_file);
+		m_file = INVALID_HANDLE_VALUE;
+	}
+#else
+	if (m_data != nullptr)
+	{
+		munmap(const_cast<uint8_t*>(m_data), m_size);
+	}
+	if (m_file != -1)
+	{
+		::close(m_file);
+		m_file = -1;
+	}
+#endif
+	m_data = nullptr;
+	m_size = 0;
+	m_numPlayers = 0;
+}
+
+///<summary> Getter for the number of players in every game of the log. </summary>
+///<returns> Number of players, or 0 when no file is open. </returns>
+inline int GameLogReader::getNumPlayers()
+{
+	return m_numPlayers;
+}
+
+///<summary> Gets the number of complete rounds in the log. </summary>
+///<returns> Number of rounds. </returns>
+inline long long GameLogReader::getNumRounds()
+{
+	return (m_data == nullptr) ? 0 : static_cast<long long>((m_size - GameLogFormat::HEADER_SIZE) / m_recordSize);
+}
+
+///<summary> Reads one round of the log. </summary>
+///<param name="roundIndex"> Index of the round, 0 to getNumRounds() - 1. </param>
+///<param name="record"> Filled with the round. </param>
+///<returns> True if the round is in the log and valid, otherwise false. </returns>
+inline bool GameLogReader::getRound(long long roundIndex, RoundRecord &record)
+{
+	if (roundIndex < 0 || roundIndex >= getNumRounds())
+	{
+		return false;
+	}
+	return GameLogFormat::decode(m_data + GameLogFormat::HEADER_SIZE + roundIndex * m_recordSize, m_numPlayers, record);
+}
+
+///<summary> Rebuilds the position part way through a logged round: after the deal and passing, and a number of tricks. </summary>
+///<param name="record"> Round to replay. </param>
+///<param name="numTricks"> Number of tricks to play. 0 gives the position just after passing. </param>
+///<param name="state"> Filled with the position. </param>
+///<returns> True if the round was valid and replayed, otherwise false and the state is left as it was. </returns>
+bool GameLogReader::replay(const RoundRecord &record, int numTricks, ReplayState &state)
+{
+	if (!GameLogFormat::isValidRecord(record))
+	{
+		return false;
+	}
+	int numPlayers = record.numPlayers;
+	state.numPlayers = numPlayers;
+	for (int p = 0; p < numPlayers; p++)
+	{
+		state.hands[p].clear();
+		state.points[p] = 0;
+	}
+	for (int i = 0; i < 52; i++)
+	{
+		if (record.dealOwners[i] != RoundRecord::NOT_DEALT)
+		{
+			state.hands[record.dealOwners[i]].addCard(BitHand::indexToCard(i));
+		}
+	}
+	if (record.passOffset != 0)
+	{
+		for (int p = 0; p < numPlayers; p++)
+		{
+			int target = (p + record.passOffset) % numPlayers;
+			for (int i = 0; i < 3; i++)
+			{
+				Card card = BitHand::indexToCard(record.passedCards[p][i]);
+				state.hands[p].removeCard(card);
+				state.hands[target].addCard(card);
+			}
+		}
+	}
+
+	// The first trick is led by whoever holds its first card
+	Card firstCard = BitHand::indexToCard(record.trickCards[0]);
+	state.leader = 0;
+	for (int p = 0; p < numPlayers; p++)
+	{
+		if (state.hands[p].hasCard(firstCard))
+		{
+			state.leader = p;
+		}
+	}
+	state.heartsBroken = false;
+	state.tricksPlayed = 0;
+	if (numTricks > GameLogFormat::getHandSize(numPlayers))
+	{
+		numTricks = GameLogFormat::getHandSize(numPlayers);
+	}
+	if (numTricks < 0)
+	{
+		numTricks = 0;
+	}
+
+	// Every trick is scored in one batch before the leaders are followed through them
+	uint8_t cardsByPosition[RoundRecord::MAX_PLAYERS][RoundRecord::MAX_HAND_SIZE];
+	const uint8_t *rows[RoundRecord::MAX_PLAYERS] = {};
+	uint8_t winningPositions[RoundRecord::MAX_HAND_SIZE];
+	uint8_t trickPoints[RoundRecord::MAX_HAND_SIZE];
+	for (int i = 0; i < numPlayers; i++)
+	{
+		for (int t = 0; t < numTricks; t++)
+		{
+			cardsByPosition[i][t] = static_cast<uint8_t>(record.trickCards[t * numPlayers + i]);
+		}
+		rows[i] = cardsByPosition[i];
+	}
+	TrickScorer::scoreTricks(rows, numPlayers, numTricks, winningPositions, trickPoints);
+
+	for (int t = 0; t < numTricks; t++)
+	{
+		for (int i = 0; i < numPlayers; i++)
+		{
+			Card card = BitHand::indexToCard(cardsByPosition[i][t]);
+			state.hands[(state.leader + i) % numPlayers].removeCard(card);
+			if (card.getSuit() == Card::Suit::HEARTS)
+			{
+				state.heartsBroken = true;
+			}
+		}
+		state.leader = (state.leader + winningPositions[t]) % numPlayers;
+		state.points[state.leader] += trickPoints[t];
+		state.tricksPlayed++;
+	}
+	return true;
+}
+
+#endif // !GAMELOG_H
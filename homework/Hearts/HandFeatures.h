@@ -0,0 +1,227 @@
+#ifndef HANDFEATURES_H
+#define HANDFEATURES_H
+#include <cstdint>
+#include "Card.h"
+#include "BitHand.h"
+
+///<summary>
+///Features of every possible holding in one suit, indexed by the suit's 13 bit mask from BitHand (bit n set when the hand
+///holds the card with number n). Built once at compile time by build(), so looking a feature up is a single array read.
+///</summary>
+struct SuitFeatureTable
+{
+	static const int NUM_MASKS = 1 << 13;
+	static const int NO_CARD = -1;
+	static const int HIGH_CARD_NUMBER = 9;	// Jack and above count as high cards
+	static const int SAFE_LOW_NUMBER = 6;	// 2 through 7 count as safe low cards, since they rarely have to win a trick
+
+	uint8_t cardCount[NUM_MASKS];
+	uint8_t highCardCount[NUM_MASKS];
+	uint8_t safeLowCount[NUM_MASKS];
+	int8_t lowestNumber[NUM_MASKS];
+	int8_t highestNumber[NUM_MASKS];
+
+	static constexpr SuitFeatureTable build();
+};
+
+///<summary>
+///Fills in every entry of the table. Each mask is worked out from the mask with its lowest card dropped (mask >> 1),
+///which was filled in just before it, so building the whole table only takes a few steps per entry.
+///</summary>
+///<returns> The finished table. </returns>
+constexpr SuitFeatureTable SuitFeatureTable::build()
+{
+	SuitFeatureTable table = {};
+	table.lowestNumber[0] = NO_CARD;
+	table.highestNumber[0] = NO_CARD;
+	for (int mask = 1; mask < NUM_MASKS; mask++)
+	{
+		int rest = mask >> 1;
+		table.cardCount[mask] = static_cast<uint8_t>(table.cardCount[rest] + (mask & 1));
+		table.lowestNumber[mask] = static_cast<int8_t>((mask & 1) ? 0 : table.lowestNumber[rest] + 1);
+		table.highestNumber[mask] = static_cast<int8_t>((rest != 0) ? table.highestNumber[rest] + 1 : 0);
+	}
+	for (int mask = 0; mask < NUM_MASKS; mask++)
+	{
+		table.highCardCount[mask] = table.cardCount[mask >> HIGH_CARD_NUMBER];
+		table.safeLowCount[mask] = table.cardCount[mask & ((1 << SAFE_LOW_NUMBER) - 1)];
+	}
+	return table;
+}
+
+///<summary>
+///Per suit features of a hand, read from tables built at compile time instead of scanning the cards.
+///Used by the computer players for passing and for choosing cards, where the same few questions are asked every decision.
+///</summary>
+class HandFeatures
+{
+public:
+	static const int NO_CARD = SuitFeatureTable::NO_CARD;
+
+	HandFeatures();
+	HandFeatures(BitHand hand);
+	~HandFeatures();
+	uint64_t getBits() const;
+	int countOfSuit(Card::Suit suit) const;
+	bool isVoid(Card::Suit suit) const;
+	int getVoidCount() const;
+	int highCardCount(Card::Suit suit) const;
+	int safeLowCount(Card::Suit suit) const;
+	int lowestNumber(Card::Suit suit) const;
+	int highestNumber(Card::Suit suit) const;
+	int highestNumberBelow(Card::Suit suit, int number) const;
+	Card lowestCard() const;
+	Card highestCard() const;
+
+	// Static Functions
+	static int suitMask(uint64_t bits, Card::Suit suit);
+
+private:
+	static constexpr SuitFeatureTable TABLE = SuitFeatureTable::build();
+
+	uint64_t m_bits;
+};
+
+///<summary> Constructor for the features of an empty hand. </summary>
+///<returns> Nothing. </returns>
+inline HandFeatures::HandFeatures()
+{
+	m_bits = 0;
+}
+
+///<summary> Constructor for the features of a hand. </summary>
+///<param name="hand"> The hand to describe. </param>
+///<returns> Nothing. </returns>
+inline HandFeatures::HandFeatures(BitHand hand)
+{
+	m_bits = hand.getBits();
+}
+
+///<summary> Default destructor for HandFeatures class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+inline HandFeatures::~HandFeatures()
+{
+}
+
+///<summary> Getter for the hand the features describe. </summary>
+///<returns> The hand as a BitHand bit set. </returns>
+inline uint64_t HandFeatures::getBits() const
+{
+	return m_bits;
+}
+
+///<summary> Gets the 13 bit mask of one suit of a hand, used to index the feature tables. </summary>
+///<param name="bits"> Hand as a BitHand bit set. </param>
+///<param name="suit"> Suit to get. </param>
+///<returns> The mask, with bit n set when the hand holds the card with number n. </returns>
+inline int HandFeatures::suitMask(uint64_t bits, Card::Suit suit)
+{
+	return static_cast<int>((bits >> (static_cast<int>(suit) * BitHand::SUIT_SIZE)) & BitHand::SUIT_BITS);
+}
+
+///<summary> Counts the cards of a suit in the hand. </summary>
+///<param name="suit"> Suit to count. </param>
+///<returns> Number of cards of the suit. </returns>
+inline int HandFeatures::countOfSuit(Card::Suit suit) const
+{
+	return TABLE.cardCount[suitMask(m_bits, suit)];
+}
+
+///<summary> Determines whether the hand has no cards of a suit. </summary>
+///<param name="suit"> Suit to check. </param>
+///<returns> True if the hand is void in the suit, otherwise false. </returns>
+inline bool HandFeatures::isVoid(Card::Suit suit) const
+{
+	return suitMask(m_bits, suit) == 0;
+}
+
+///<summary> Counts the suits the hand has no cards of. </summary>
+///<returns> Number of void suits, 0 to 4. </returns>
+inline int HandFeatures::getVoidCount() const
+{
+	int voids = 0;
+	for (int suit = 0; suit < 4; suit++)
+	{
+		voids += isVoid(static_cast<Card::Suit>(suit)) ? 1 : 0;
+	}
+	return voids;
+}
+
+///<summary> Counts the Jacks, Queens, Kings, and Aces of a suit in the hand. </summary>
+///<param name="suit"> Suit to count. </param>
+///<returns> Number of high cards of the suit. </returns>
+inline int HandFeatures::highCardCount(Card::Suit suit) const
+{
+	return TABLE.highCardCount[suitMask(m_bits, suit)];
+}
+
+///<summary> Counts the 2s through 7s of a suit in the hand. These are the cards most likely to duck under a trick. </summary>
+///<param name="suit"> Suit to count. </param>
+///<returns> Number of safe low cards of the suit. </returns>
+inline int HandFeatures::safeLowCount(Card::Suit suit) const
+{
+	return TABLE.safeLowCount[suitMask(m_bits, suit)];
+}
+
+///<summary> Finds the lowest card of a suit in the hand. </summary>
+///<param name="suit"> Suit to search. </param>
+///<returns> Number of the lowest card of the suit, or NO_CARD if the hand is void in it. </returns>
+inline int HandFeatures::lowestNumber(Card::Suit suit) const
+{
+	return TABLE.lowestNumber[suitMask(m_bits, suit)];
+}
+
+///<summary> Finds the highest card of a suit in the hand. </summary>
+///<param name="suit"> Suit to search. </param>
+///<returns> Number of the highest card of the suit, or NO_CARD if the hand is void in it. </returns>
+inline int HandFeatures::highestNumber(Card::Suit suit) const
+{
+	return TABLE.highestNumber[suitMask(m_bits, suit)];
+}
+
+///<summary> Finds the highest card of a suit that is lower than a given card, which is the card to duck with. </summary>
+///<param name="suit"> Suit to search. </param>
+///<param name="number"> Number of the card to stay under (0-12). </param>
+///<returns> Number of the card, or NO_CARD if the hand has nothing of the suit lower than number. </returns>
+inline int HandFeatures::highestNumberBelow(Card::Suit suit, int number) const
+{
+	return TABLE.highestNumber[suitMask(m_bits, suit) & ((1 << number) - 1)];
+}
+
+///<summary> Finds the card with the lowest number in the hand. Between cards with the same number the lowest suit is chosen. </summary>
+///<returns> The lowest card. Should only be called on a hand that is not empty. </returns>
+Card HandFeatures::lowestCard() const
+{
+	int bestSuit = 0;
+	int bestNumber = SuitFeatureTable::NUM_MASKS;
+	for (int suit = 0; suit < 4; suit++)
+	{
+		int number = lowestNumber(static_cast<Card::Suit>(suit));
+		if (number != NO_CARD && number < bestNumber)
+		{
+			bestSuit = suit;
+			bestNumber = number;
+		}
+	}
+	return Card(bestNumber, static_cast<Card::Suit>(bestSuit));
+}
+
+///<summary> Finds the card with the highest number in the hand. Between cards with the same number the highest suit is chosen. </summary>
+///<returns> The highest card. Should only be called on a hand that is not empty. </returns>
+Card HandFeatures::highestCard() const
+{
+	int bestSuit = 0;
+	int bestNumber = NO_CARD;
+	for (int suit = 0; suit < 4; suit++)
+	{
+		int number = highestNumber(static_cast<Card::Suit>(suit));
+		if (number != NO_CARD && number >= bestNumber)
+		{
+			bestSuit = suit;
+			bestNumber = number;
+		}
+	}
+	return Card(bestNumber, static_cast<Card::Suit>(bestSuit));
+}
+
+#endif // !HANDFEATURES_H
@@ -0,0 +1,453 @@
+#ifndef HEARTSBENCHMARK_H
+#define HEARTSBENCHMARK_H
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include "Card.h"
+#include "Deck.h"
+#include "BitHand.h"
+#include "EndgameSolver.h"
+#include "TrickScorer.h"
+#include "TrickState.h"
+#include "HeartsGame.h"
+#include "HeuristicPolicy.h"
+
+///<summary>
+///Timing for one benchmarked operation.
+///</summary>
+struct BenchmarkResult
+{
+	std::string name;
+	long long iterations;
+	double nanosecondsPerOperation;
+};
+
+///<summary>
+///Times the hot paths of the Hearts engine so changes to them can be compared.
+///Every benchmark works through the same set of pre-shuffled decks so the branch predictor cannot learn a single deal.
+///Results can be saved to a file and a later run compared against them, so a change can be checked against a recorded baseline.
+///</summary>
+class HeartsBenchmark
+{
+public:
+	HeartsBenchmark(int numPlayers);
+	HeartsBenchmark(int numPlayers, unsigned int seed);
+	~HeartsBenchmark();
+	void run(int iterations);
+	std::vector<BenchmarkResult> getResults();
+	void display();
+	bool saveResults(const std::string &fileName);
+	bool loadBaseline(const std::string &fileName);
+
+private:
+	static const int NUM_DECKS = 64;
+	static const int ENDGAME_TRICKS = 5;
+
+	int m_numPlayers;
+	int m_handSize;
+	std::vector<Deck> m_decks;
+	std::vector<BenchmarkResult> m_results;
+	std::vector<BenchmarkResult> m_baseline;
+	long long m_checksum; // Results are added in here so the compiler cannot throw the work away
+
+	void initialize(unsigned int seed);
+	template <class Operation> void measure(std::string name, int iterations, Operation operation);
+	const BenchmarkResult *findBaseline(const std::string &name);
+	void benchmarkShuffle(int iterations);
+	void benchmarkDealAndSort(int iterations);
+	void benchmarkDealSorted(int iterations);
+	void benchmarkHandSort(int iterations);
+	void benchmarkLegalMoves(int iterations);
+	void benchmarkTrickScoring(int iterations);
+	void benchmarkGame(int iterations);
+	void benchmarkEndgameSolver(int iterations);
+};
+
+///<summary> Constructor for HeartsBenchmark object. Decks are shuffled with a fixed seed so runs can be compared. </summary>
+///<param name="numPlayers"> Number of hands dealt from each deck (3-5). </param>
+///<returns> Nothing. </returns>
+HeartsBenchmark::HeartsBenchmark(int numPlayers)
+{
+	m_numPlayers = numPlayers;
+	initialize(0);
+}
+
+///<summary> Constructor for HeartsBenchmark object. </summary>
+///<param name="numPlayers"> Number of hands dealt from each deck (3-5). </param>
+///<param name="seed"> Seed for shuffling the decks. </param>
+///<returns> Nothing. </returns>
+HeartsBenchmark::HeartsBenchmark(int numPlayers, unsigned int seed)
+{
+	m_numPlayers = numPlayers;
+	initialize(seed);
+}
+
+///<summary> Default destructor for HeartsBenchmark class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+HeartsBenchmark::~HeartsBenchmark()
+{
+}
+
+///<summary> Shuffles the decks used by every benchmark. </summary>
+///<param name="seed"> Seed for shuffling the decks. </param>
+///<returns> Nothing. </returns>
+void HeartsBenchmark::initialize(unsigned int seed)
+{
+	m_handSize = 52 / m_numPlayers;
+	m_checksum = 0;
+	for (int i = 0; i < NUM_DECKS; i++)
+	{
+		m_decks.push_back(Deck(seed + i));
+		m_decks.at(i).shuffle();
+	}
+}
+
+///<summary> Runs every benchmark. Results from an earlier run are replaced. </summary>
+///<param name="iterations"> Number of times each operation is timed. </param>
+///<returns> Nothing. </returns>
+void HeartsBenchmark::run(int iterations)
+{
+	m_results.clear();
+	benchmarkShuffle(iterations);
+	benchmarkDealAndSort(iterations);
+	benchmarkDealSorted(iterations);
+	benchmarkHandSort(iterations);
+	benchmarkLegalMoves(iterations);
+	benchmarkTrickScoring(iterations);
+	// A round takes around a hundred times longer than a deal
+	benchmarkGame(iterations / 100 + 1);
+	// A solve takes around a thousand times longer than a deal
+	benchmarkEndgameSolver(iterations / 1000 + 1);
+}
+
+///<summary> Getter for the results of the last run. </summary>
+///<returns> One BenchmarkResult for each benchmark, in the order they ran. </returns>
+inline std::vector<BenchmarkResult> HeartsBenchmark::getResults()
+{
+	return m_results;
+}
+
+///<summary> Displays the results of the last run on the console. </summary>
+///<returns> Nothing. </returns>
+void HeartsBenchmark::display()
+{
+	std::cout << std::left << std::setw(30) << "Benchmark" << std::setw(15) << "Iterations" << std::setw(15) << "ns/op" << std::setw(15) << "ops/s";
+	if (!m_baseline.empty())
+	{
+		std::cout << std::setw(15) << "Baseline ns/op" << std::setw(10) << "Change";
+	}
+	std::cout << '\n';
+	for (BenchmarkResult &result : m_results)
+	{
+		std::cout << std::left << std::setw(30) << result.name << std::setw(15) << result.iterations
+			<< std::fixed << std::setprecision(1) << std::setw(15) << result.nanosecondsPerOperation
+			<< std::setprecision(0) << std::setw(15) << 1e9 / result.nanosecondsPerOperation;
+		const BenchmarkResult *baseline = findBaseline(result.name);
+		if (baseline != nullptr)
+		{
+			double change = 100.0 * (result.nanosecondsPerOperation - baseline->nanosecondsPerOperation) / baseline->nanosecondsPerOperation;
+			std::cout << std::setprecision(1) << std::setw(15) << baseline->nanosecondsPerOperation
+				<< std::showpos << change << '%' << std::noshowpos;
+		}
+		std::cout << '\n';
+	}
+	std::cout << std::defaultfloat << std::setprecision(6);
+}
+
+///<summary> Writes the results of the last run to a file, one benchmark per line: name, iterations, and ns/op separated by tabs. </summary>
+///<param name="fileName"> File to write. </param>
+///<returns> True if the file was written, otherwise false. </returns>
+bool HeartsBenchmark::saveResults(const std::string &fileName)
+{
+	std::ofstream file(fileName);
+	if (!file)
+	{
+		return false;
+	}
+	for (BenchmarkResult &result : m_results)
+	{
+		file << result.name << '\t' << result.iterations << '\t' << std::setprecision(10) << result.nanosecondsPerOperation << '\n';
+	}
+	return static_cast<bool>(file);
+}
+
+///<summary> Reads results saved by saveResults(). display() then shows how each benchmark compares with them. </summary>
+///<param name="fileName"> File to read. </param>
+///<returns> True if the file was read, otherwise false. </returns>
+bool HeartsBenchmark::loadBaseline(const std::string &fileName)
+{
+	std::ifstream file(fileName);
+	std::string line;
+	if (!file)
+	{
+		return false;
+	}
+	m_baseline.clear();
+	while (std::getline(file, line))
+	{
+		BenchmarkResult result;
+		std::istringstream fields(line);
+		if (std::getline(fields, result.name, '\t') && (fields >> result.iterations >> result.nanosecondsPerOperation))
+		{
+			m_baseline.push_back(result);
+		}
+	}
+	return true;
+}
+
+///<summary> Finds a benchmark in the baseline. </summary>
+///<param name="name"> Name of the benchmark. </param>
+///<returns> The baseline result, or nullptr if the baseline does not have the benchmark. </returns>
+const BenchmarkResult *HeartsBenchmark::findBaseline(const std::string &name)
+{
+	for (BenchmarkResult &result : m_baseline)
+	{
+		if (result.name == name)
+		{
+			return &result;
+		}
+	}
+	return nullptr;
+}
+
+///<summary> Times an operation and records the average time per call. </summary>
+///<param name="name"> Name to report the benchmark under. </param>
+///<param name="iterations"> Number of times to call the operation. </param>
+///<param name="operation"> Called with the iteration number, 0 to iterations - 1. </param>
+///<returns> Nothing. </returns>
+template <class Operation>
+void HeartsBenchmark::measure(std::string name, int iterations, Operation operation)
+{
+	auto startTime = std::chrono::steady_clock::now();
+	for (int i = 0; i < iterations; i++)
+	{
+		operation(i);
+	}
+	std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - startTime;
+	m_results.push_back({ name, iterations, elapsed.count() / (iterations > 0 ? iterations : 1) });
+}
+
+///<summary> Times Deck::shuffle() on a full deck. </summary>
+///<param name="iterations"> Number of shuffles to time. </param>
+///<returns> Nothing. </returns>
+void HeartsBenchmark::benchmarkShuffle(int iterations)
+{
+	// A deck of its own, so the decks the other benchmarks deal from stay the same
+	Deck deck(static_cast<unsigned int>(m_checksum));
+	measure("Shuffle", iterations, [&](int)
+	{
+		deck.shuffle();
+	});
+	m_checksum += deck.deal(1, 1).at(0).at(0).getIndex();
+}
+
+///<summary> Times the original path: Deck::deal() into new vectors, then Deck::sort() (merge sort) on every hand. </summary>
+///<param name="iterations"> Number of deals to time. </param>
+///<returns> Nothing. </returns>
+void HeartsBenchmark::benchmarkDealAndSort(int iterations)
+{
+	measure("Deal + merge sort", iterations, [&](int i)
+	{
+		std::vector<std::vector<Card>> hands = m_decks.at(i % NUM_DECKS).deal(m_numPlayers, m_handSize);
+		for (std::vector<Card> &hand : hands)
+		{
+			Deck::sort(hand);
+		}
+		m_checksum += hands.at(0).at(0).getIndex();
+	});
+}
+
+///<summary> Times Deck::dealSorted(), which deals already sorted hands into reused vectors. </summary>
+///<param name="iterations"> Number of deals to time. </param>
+///<returns> Nothing. </returns>
+void HeartsBenchmark::benchmarkDealSorted(int iterations)
+{
+	std::vector<std::vector<Card>> hands;
+	measure("Deal sorted (counting sort)", iterations, [&](int i)
+	{
+		m_decks.at(i % NUM_DECKS).dealSorted(m_numPlayers, m_handSize, hands);
+		m_checksum += hands.at(0).at(0).getIndex();
+	});
+}
+
+///<summary>
+///Times sorting a dealt hand, first with Deck::sort() (merge sort) and then through a BitHand, the way Player keeps its hand.
+///Both times include copying the unsorted hand so the sort always has the same work to do.
+///</summary>
+///<param name="iterations"> Number of hands to sort each way. </param>
+///<returns> Nothing. </returns>
+void HeartsBenchmark::benchmarkHandSort(int iterations)
+{
+	std::vector<std::vector<Card>> hands;
+	for (int d = 0; d < NUM_DECKS; d++)
+	{
+		hands.push_back(m_decks.at(d).deal(1, m_handSize).at(0));
+	}
+	std::vector<Card> hand;
+	measure("Hand sort (merge sort)", iterations, [&](int i)
+	{
+		hand = hands.at(i % NUM_DECKS);
+		Deck::sort(hand);
+		m_checksum += hand.at(0).getIndex();
+	});
+	measure("Hand sort (bit set)", iterations, [&](int i)
+	{
+		hand = hands.at(i % NUM_DECKS);
+		BitHand(hand).toVector(hand);
+		m_checksum += hand.at(0).getIndex();
+	});
+}
+
+///<summary>
+///Times HeartsGame::legalMoves() over every dealt hand with a spread of trick states: leading before and after Hearts
+///are broken, and following each suit.
+///</summary>
+///<param name="iterations"> Number of hands to find legal moves for. </param>
+///<returns> Nothing. </returns>
+void HeartsBenchmark::benchmarkLegalMoves(int iterations)
+{
+	const int NUM_STATES = 6;
+	std::vector<BitHand> hands;
+	for (int d = 0; d < NUM_DECKS; d++)
+	{
+		hands.push_back(BitHand(m_decks.at(d).deal(1, m_handSize).at(0)));
+	}
+	TrickState states[NUM_STATES];
+	for (int s = 0; s < NUM_STATES; s++)
+	{
+		states[s].isFirstTrickOfRound = false;
+		states[s].isLeadingCard = s < 2;
+		states[s].canPlayHearts = s == 1;
+		states[s].canLeadQofS = true;
+		states[s].leadingCardSuit = static_cast<Card::Suit>(s < 2 ? 0 : s - 2);
+		states[s].startingCard = HeartsGame::getStartingCard(m_numPlayers);
+	}
+	measure("Legal moves", iterations, [&](int i)
+	{
+		m_checksum += HeartsGame::legalMoves(hands.at(i % NUM_DECKS), states[i % NUM_STATES]).getBits() & 0xFF;
+	});
+}
+
+///<summary>
+///Times whole headless games between HeuristicPolicy players: single tricks with HeartsGame::simulateTricks(), dealing
+///whenever a round ends, then whole rounds with HeartsGame::simulateRounds(). ops/s for the round benchmark is rounds per second.
+///</summary>
+///<param name="iterations"> Number of rounds to time. Ten times as many tricks are timed. </param>
+///<returns> Nothing. </returns>
+void HeartsBenchmark::benchmarkGame(int iterations)
+{
+	HeuristicPolicy policy;
+	HeartsGame game(m_numPlayers);
+	game.setHeadless(true);
+	game.setSeed(static_cast<unsigned int>(m_checksum));
+	for (int p = 0; p < m_numPlayers; p++)
+	{
+		game.setPlayerPolicy(p, &policy);
+	}
+	measure("Trick (heuristic players)", iterations * 10, [&](int)
+	{
+		game.simulateTricks(1);
+	});
+	measure("Round (heuristic players)", iterations, [&](int)
+	{
+		game.simulateRounds(1);
+	});
+	m_checksum += game.getPlayerPointsTotal(0);
+}
+
+///<summary>
+///Times TrickScorer on the tricks made by cutting every deck into groups of one card per player.
+///Tricks are scored one at a time, the way a single game scores them, and then all together with TrickScorer::scoreTricks().
+///Each call scores every trick either way, so the cost of the call itself is shared out the same, and both are reported per trick.
+///</summary>
+///<param name="iterations"> Number of tricks to score each way. </param>
+///<returns> Nothing. </returns>
+void HeartsBenchmark::benchmarkTrickScoring(int iterations)
+{
+	int numTricks = NUM_DECKS * m_handSize;
+	std::vector<uint8_t> tricks;	// One trick after another
+	std::vector<std::vector<uint8_t>> cardsByPosition(m_numPlayers, std::vector<uint8_t>(numTricks));
+	for (int d = 0; d < NUM_DECKS; d++)
+	{
+		std::vector<Card> cards = m_decks.at(d).deal(1, m_numPlayers * m_handSize).at(0);
+		for (int t = 0; t < m_handSize; t++)
+		{
+			for (int p = 0; p < m_numPlayers; p++)
+			{
+				uint8_t card = cards.at(t * m_numPlayers + p).getIndex();
+				tricks.push_back(card);
+				cardsByPosition.at(p).at(d * m_handSize + t) = card;
+			}
+		}
+	}
+
+	int batches = iterations / numTricks + 1;
+	measure("Trick score (one at a time)", batches, [&](int)
+	{
+		for (int t = 0; t < numTricks; t++)
+		{
+			const uint8_t *trick = tricks.data() + t * m_numPlayers;
+			m_checksum += TrickScorer::findWinningPosition(trick, m_numPlayers) + TrickScorer::tallyPoints(trick, m_numPlayers);
+		}
+	});
+	// Report per trick rather than per call
+	m_results.back().iterations = static_cast<long long>(batches) * numTricks;
+	m_results.back().nanosecondsPerOperation /= numTricks;
+
+	std::vector<const uint8_t*> rows;
+	for (std::vector<uint8_t> &row : cardsByPosition)
+	{
+		rows.push_back(row.data());
+	}
+	std::vector<uint8_t> winningPositions(numTricks);
+	std::vector<uint8_t> points(numTricks);
+	measure("Trick score (batch)", batches, [&](int i)
+	{
+		TrickScorer::scoreTricks(rows.data(), m_numPlayers, numTricks, winningPositions.data(), points.data());
+		m_checksum += winningPositions.at(i % numTricks) + points.at(i % numTricks);
+	});
+	// Report the batch per trick rather than per call
+	m_results.back().iterations = static_cast<long long>(batches) * numTricks;
+	m_results.back().nanosecondsPerOperation /= numTricks;
+}
+
+///<summary>
+///Times EndgameSolver on the last few tricks of a round. Each deck gives every player its first cards as their hand,
+///and every point card left over counts as taken by Player 1. The transposition table is cleared before each solve.
+///</summary>
+///<param name="iterations"> Number of endgames to solve. </param>
+///<returns> Nothing. </returns>
+void HeartsBenchmark::benchmarkEndgameSolver(int iterations)
+{
+	EndgameSolver solver;
+	std::vector<std::vector<BitHand>> positions(NUM_DECKS);
+	std::vector<std::vector<int>> points(NUM_DECKS, std::vector<int>(m_numPlayers, 0));
+	std::vector<bool> heartsBroken(NUM_DECKS);
+	for (int d = 0; d < NUM_DECKS; d++)
+	{
+		uint64_t inHands = 0;
+		for (std::vector<Card> &hand : m_decks.at(d).deal(m_numPlayers, ENDGAME_TRICKS))
+		{
+			positions.at(d).push_back(BitHand(hand));
+			inHands |= BitHand(hand).getBits();
+		}
+		uint64_t hearts = BitHand::suitMask(Card::Suit::HEARTS) & ~inHands;
+		bool queenTaken = !(inHands & BitHand::cardBit(Card(10, Card::Suit::SPADES)));
+		points.at(d).at(0) = BitHand::countBits(hearts) + (queenTaken ? 13 : 0);
+		heartsBroken.at(d) = hearts != 0;
+	}
+
+	std::vector<Card> noTrickCards;
+	measure("Endgame solve (" + std::to_string(ENDGAME_TRICKS) + " tricks)", iterations, [&](int i)
+	{
+		int d = i % NUM_DECKS;
+		solver.clearTable();
+		m_checksum += solver.solve(positions.at(d), points.at(d), noTrickCards, 0, heartsBroken.at(d)).nodesSearched;
+	});
+}
+
+#endif // !HEARTSBENCHMARK_H
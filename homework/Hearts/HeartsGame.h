@@ -6,106 +6,186 @@
 #include <cctype>
 #include <algorithm> // needed for std::includes()
 #include <string>
-#include <Windows.h>
+#include <fstream>
+#include <cstring> // for memcmp()
 #include "Card.h"
 #include "Deck.h"
 #include "Player.h"
+#include "BitHand.h"
+#include "TrickState.h"
 #include "InvalidCardPlayed.h"
+#include "PlayerPolicy.h"
+#include "GameLog.h"
+#include "HeartsState.h"
+#include "TrickScorer.h"
+#include "HeartsRules.h"
+#include "Console.h"
+
+// Defined in EndgameSolver.h, which includes this file. solveEndgame() is defined there too
+class EndgameSolver;
+struct EndgameResult;
 
 ///<summary> 
 ///Class that holds necessary variables and functions to allow user to play a game of Hearts.
 ///Supports 3, 4, or 5 players.
+///Any seat can be given a PlayerPolicy so that a computer plays for it. If every seat has a policy the game can be run headless,
+///meaning whole rounds are played without any console input or output.
+///Rules is a rule set from HeartsRules.h. It picks the pass direction each round, the deck for each number of players,
+///and the scoring variant, and is fixed when the game is compiled.
+///A seat's policy may also make the game wait for its decision (see PlayerPolicy). Games with such seats are driven with
+///playUntilWaiting(), which returns whenever a decision is not ready and carries on from the same point the next time.
 ///</summary>
-class HeartsGame
+template <class Rules>
+class BasicHeartsGame
 {
 public:
-	HeartsGame();
-	HeartsGame(int numPlayers);
-	~HeartsGame();
+	BasicHeartsGame();
+	BasicHeartsGame(int numPlayers);
+	~BasicHeartsGame();
 	void start();
+	void simulateRounds(int numRounds);
+	void simulateTricks(int numTricks);
+	bool playUntilWaiting(int maxTricks);
+	void setPlayerPolicy(int playerIndex, PlayerPolicy *policy);
+	void setHeadless(bool headless);
+	void setGameLog(GameLogWriter *gameLog);
+	int getNumPlayers();
+	int getPlayerPointsTotal(int playerIndex);
+	int getShootTheMoonCount(int playerIndex);
+	int getRoundsPlayed();
+	void setSeed(unsigned int seed);
+	HeartsState getState();
+	void setState(const HeartsState &state);
+	bool isValidState(const HeartsState &state);
+	EndgameResult solveEndgame(EndgameSolver &solver);
+	bool saveState(const std::string &fileName);
+	bool loadState(const std::string &fileName);
+	BitHand legalMoves(int playerIndex, const TrickState &trickState);
+	static BitHand legalMoves(BitHand hand, const TrickState &trickState);
+	static Card getStartingCard(int numPlayers);
+	static BitHand getRemovedCards(int numPlayers);
 	static bool isValidNumberOfPlayers(int numPlayers);
-	
+
 
 private:
+	// Bit positions follow BitHand, (suit * 13 + number)
+	static const uint64_t QUEEN_OF_SPADES_BIT = uint64_t(1) << (3 * 13 + 10);
+	static const uint64_t HEARTS_BITS = BitHand::SUIT_BITS << (2 * 13);
+
 	std::vector<Player> m_players;
 	Deck m_deck;
 	int m_handSize;
 	Card m_startingCard;
 	Card::Suit m_leadingCardSuit;
 	bool m_canPlayHearts;
+	bool m_headless;
+	Console m_console;
+	std::vector<PlayerPolicy*> m_policies;
+	GameLogWriter *m_gameLog;
+	std::vector<Card> m_playedCards;
+	std::vector<int> m_playedCardPlayers;
+	std::vector<int> m_shootTheMoonCounts;
+	int m_roundsPlayed;
+	// Progress through the current round
+	bool m_isRoundInProgress;
+	bool m_isPassPending;	// Dealt, but the cards have not been passed yet
+	bool m_isWaiting;		// The last trick or pass stopped because a policy was not ready
+	bool m_isRoundLogged;
+	bool m_isFirstTrick;
+	int m_trickLeader;
+	std::vector<int> m_playerOrder;
+	std::vector<Card> m_trickCards;
+	std::vector<std::vector<Card>> m_dealtHands; // Reused every round so dealing does not allocate
+	// Reused for every policy decision so asking a policy for a card does not allocate
+	std::vector<Card> m_playableCards;
+	std::vector<int> m_pointsThisRound;
 
 	int findStartingRoundPlayerPos();
 	void initializePlayerHands();
-	void passCards();
-	int tallyPoints(std::vector<Card> &cards);
-	bool isValidCardPlay(Card &card, int playerIndex, bool canLeadQofS, bool isFirstTrickOfGame, bool isLeadingCard);
+	bool passCards(int passOffset);
+	int tallyPoints(const std::vector<Card> &cards);
+	bool isValidCardPlay(Card &card, int playerIndex, const TrickState &trickState);
+	TrickState getTrickState(bool isFirstTrickOfGame, bool isLeadingCard, bool canLeadQofS);
+	bool choosePolicyCard(int playerIndex, const std::vector<int> &playerOrder, const std::vector<Card> &trickCards, const TrickState &trickState, Card &card);
 	void initializePlayerOrder(std::vector<int> &playerOrder, bool isFirstTrickOfGame, int largestCardPosition);
-	void playTrick(std::vector<int> playerOrder, std::vector<Card> &trickCards, bool isFirstTrickOfGame);
+	void playTrick(const std::vector<int> &playerOrder, std::vector<Card> &trickCards, bool isFirstTrickOfGame);
 	void setLeadingCardSuit(Card::Suit suit);
-	void setCanPlayHearts(int playerIndex, bool isLeadingCard);
 	void handleShootTheMoon();
 	void endRound();
-	bool isDuplicatePassedCard(std::vector<Card> &passedCards, std::string cardStr);
+	bool isDuplicatePassedCard(const std::vector<Card> &passedCards, const std::string &cardStr);
 	void playRound();
+	void startRound();
+	void playNextTrick();
 	void display(std::string title);
-	int findPosOfWinningCardInTrick(std::vector<Card> &trickCards);
-	
+	int findPosOfWinningCardInTrick(const std::vector<Card> &trickCards);
 };
 
+// The usual game. Variants are played with BasicHeartsGame<OmnibusRules> and so on
+typedef BasicHeartsGame<StandardRules> HeartsGame;
 ///<summary> Default constructor for HeartsGame. If used it assumes only 4 players. By default doesn't support 3 or 5. </summary>
 ///<returns> Nothing. </returns>
-HeartsGame::HeartsGame()
+template <class Rules>
+BasicHeartsGame<Rules>::BasicHeartsGame()
 {
 	m_startingCard.setNumAndSuit(0, Card::Suit::CLUBS);
 	m_handSize = 13;
+	m_headless = false;
+	m_gameLog = nullptr;
+	m_roundsPlayed = 0;
+	m_isRoundInProgress = false;
+	m_isPassPending = false;
+	m_isWaiting = false;
+	m_isRoundLogged = false;
+	m_isFirstTrick = true;
+	m_trickLeader = HeartsState::NO_LEADER;
 }
 
 ///<summary> Constructor for HeartsGame object that sets up the deck for the given number of players. </summary>
 ///<param name="numPlayers"> Number of players in the game. </param>
 ///<returns> Nothing. </returns>
-inline HeartsGame::HeartsGame(int numPlayers)
+template <class Rules>
+inline BasicHeartsGame<Rules>::BasicHeartsGame(int numPlayers)
 {
+	BitHand removedCards = BasicHeartsGame::getRemovedCards(numPlayers);
 	m_players.resize(numPlayers);
+	m_policies.resize(numPlayers, nullptr);
+	m_shootTheMoonCounts.resize(numPlayers, 0);
 	m_canPlayHearts = false;
-	if (numPlayers == 3)
+	m_headless = false;
+	m_gameLog = nullptr;
+	m_roundsPlayed = 0;
+	m_isRoundInProgress = false;
+	m_isPassPending = false;
+	m_isWaiting = false;
+	m_isRoundLogged = false;
+	m_isFirstTrick = true;
+	m_trickLeader = HeartsState::NO_LEADER;
+	m_startingCard = BasicHeartsGame::getStartingCard(numPlayers);
+	for (Card card : removedCards.toVector())
 	{
-		m_startingCard.setNumAndSuit(0, Card::Suit::CLUBS);
-		Card card(0, Card::Suit::DIAMONDS);
 		m_deck.removeOneDeckCard(card);
-		m_handSize = 17;
-	}
-	else if (numPlayers == 5)
-	{
-		m_startingCard.setNumAndSuit(1, Card::Suit::CLUBS);
-		Card card1(0, Card::Suit::DIAMONDS);
-		Card card2(0, Card::Suit::CLUBS);
-		m_deck.removeOneDeckCard(card1);
-		m_deck.removeOneDeckCard(card2);
-		m_handSize = 10;
-	}
-	else
-	{
-		m_startingCard.setNumAndSuit(0, Card::Suit::CLUBS);
-		m_handSize = 13;
 	}
+	m_handSize = (52 - removedCards.size()) / numPlayers;
 }
 
 ///<summary> Default destructor for HeartsGame. No special actions taken. </summary>
 ///<returns> Nothing. </returns>
-HeartsGame::~HeartsGame()
+template <class Rules>
+BasicHeartsGame<Rules>::~BasicHeartsGame()
 {
 }
 
 ///<summary> Starts a game of Hearts. </summary>
 ///<returns> Nothing. </returns>
-void HeartsGame::start()
+template <class Rules>
+void BasicHeartsGame<Rules>::start()
 {
 	bool keepPlaying = true;
 	char choice;
 	do
 	{
-		HeartsGame::playRound();
-		HeartsGame::display("End Of Round");
+		BasicHeartsGame::playRound();
+		BasicHeartsGame::display("End Of Round");
 
 		std::cout << "Continue playing? (Y/N) ";
 		std::cin >> choice;
@@ -121,104 +201,588 @@ void HeartsGame::start()
 
 }
 
-///<summary> Plays a single round of Hearts. Meaning the entire deck is dealt and the round only ends when all players are out of cards. </summary>
+///<summary>
+///Plays a number of rounds back to back with no prompts between them.
+///NOTE: Meant for headless games where every seat has a PlayerPolicy, otherwise the game still waits on console input for the human seats.
+///</summary>
+///<param name="numRounds"> Number of rounds to play. </param>
 ///<returns> Nothing. </returns>
-void HeartsGame::playRound()
+template <class Rules>
+void BasicHeartsGame<Rules>::simulateRounds(int numRounds)
 {
-	bool isFirstTrickOfGame = true;
-	std::vector<int> playerOrder;
-	std::vector<Card> trickCards;
-	int nextLeadingPlayerPosition = -1;
-	std::string titleText;
+	for (int i = 0; i < numRounds; i++)
+	{
+		BasicHeartsGame::playRound();
+	}
+}
 
-	std::cin.ignore();
-	HeartsGame::initializePlayerHands();
-	HeartsGame::passCards();
+///<summary>
+///Plays a number of tricks, dealing a new round whenever the last one has finished. Stops between tricks,
+///which makes it a convenient point to take a snapshot with getState().
+///</summary>
+///<param name="numTricks"> Number of tricks to play. </param>
+///<returns> Nothing. </returns>
+template <class Rules>
+void BasicHeartsGame<Rules>::simulateTricks(int numTricks)
+{
+	for (int i = 0; i < numTricks; i++)
+	{
+		if (!m_isRoundInProgress)
+		{
+			BasicHeartsGame::startRound();
+		}
+		BasicHeartsGame::playNextTrick();
+	}
+}
 
-	// Keep playing until players run out of cards. Need to initialize player order first, then play the trick
-	while (m_players.at(0).getRoundHand().size() > 0)
+///<summary>
+///Plays up to a number of tricks, dealing a new round first if none is in progress. Stops early at the end of the round,
+///or when a seat's policy is not ready to pass or play. Calling it again carries on from the same card.
+///Used to drive a game a slice at a time, so one game can never hold up whatever is driving it for longer than maxTricks tricks.
+///</summary>
+///<param name="maxTricks"> Most tricks to play. </param>
+///<returns> False if the game stopped to wait for a policy, otherwise true. </returns>
+template <class Rules>
+bool BasicHeartsGame<Rules>::playUntilWaiting(int maxTricks)
+{
+	if (!m_isRoundInProgress)
+	{
+		BasicHeartsGame::startRound();
+	}
+	for (int i = 0; i < maxTricks && m_isRoundInProgress; i++)
 	{
-		HeartsGame::initializePlayerOrder(playerOrder, isFirstTrickOfGame, nextLeadingPlayerPosition);
-		if (isFirstTrickOfGame)
+		BasicHeartsGame::playNextTrick();
+		if (m_isWaiting)
 		{
-			titleText = "Playing Round - Must begin with: " + m_startingCard.getDescription();
+			return false;
 		}
-		else
+	}
+	return true;
+}
+
+///<summary> Takes a snapshot of the game. Restoring it with setState() puts the game back exactly where it was. </summary>
+///<returns> The state of the game. </returns>
+template <class Rules>
+HeartsState BasicHeartsGame<Rules>::getState()
+{
+	HeartsState state = {};
+	int numPlayers = m_players.size();
+	state.numPlayers = numPlayers;
+	for (int p = 0; p < numPlayers; p++)
+	{
+		state.hands[p] = m_players.at(p).getRoundHandBits().getBits();
+		state.pointsTotal[p] = m_players.at(p).getPointsTotal();
+		state.pointsThisRound[p] = m_players.at(p).getPointsThisRound();
+		state.pointsThisTrick[p] = m_players.at(p).getPointsThisTrick();
+		state.shootTheMoonCounts[p] = m_shootTheMoonCounts.at(p);
+	}
+	state.roundsPlayed = m_roundsPlayed;
+	state.isRoundInProgress = m_isRoundInProgress;
+	state.isPassPending = m_isPassPending;
+	state.isFirstTrickOfRound = m_isFirstTrick;
+	state.canPlayHearts = m_canPlayHearts;
+	state.leadingCardSuit = m_leadingCardSuit;
+	state.trickLeader = m_trickCards.empty() ? m_trickLeader : m_playerOrder.at(0);
+	state.trickSize = m_trickCards.size();
+	for (int i = 0; i < state.trickSize; i++)
+	{
+		state.trickCards[i] = static_cast<uint8_t>(m_trickCards.at(i).getIndex());
+	}
+	state.numPlayedCards = m_playedCards.size();
+	for (int i = 0; i < state.numPlayedCards; i++)
+	{
+		state.playedCards[i] = static_cast<uint8_t>(m_playedCards.at(i).getIndex());
+		state.playedCardPlayers[i] = static_cast<uint8_t>(m_playedCardPlayers.at(i));
+	}
+	state.deckSize = m_deck.getCardOrder(state.deckCards);
+	m_deck.getGeneratorState(state.deckGeneratorState);
+	return state;
+}
+
+///<summary>
+///Puts the game back into a state taken with getState(). The next call to playRound(), simulateRounds() or simulateTricks()
+///carries on from there. A round restored part way through is not written to the game log.
+///NOTE: Assumes the state was taken from a game with the same number of players. A state from anywhere else, such as
+///a file, should be checked with isValidState() first.
+///</summary>
+///<param name="state"> The state to restore. </param>
+///<returns> Nothing. </returns>
+template <class Rules>
+void BasicHeartsGame<Rules>::setState(const HeartsState &state)
+{
+	int numPlayers = m_players.size();
+	for (int p = 0; p < numPlayers; p++)
+	{
+		m_players.at(p).setRoundHand(BitHand(state.hands[p]).toVector());
+		m_players.at(p).setPoints(state.pointsTotal[p], state.pointsThisRound[p], state.pointsThisTrick[p]);
+		m_shootTheMoonCounts.at(p) = state.shootTheMoonCounts[p];
+	}
+	m_roundsPlayed = state.roundsPlayed;
+	m_isRoundInProgress = state.isRoundInProgress;
+	m_isPassPending = state.isPassPending;
+	m_isWaiting = false;
+	m_isRoundLogged = false;
+	m_isFirstTrick = state.isFirstTrickOfRound;
+	m_canPlayHearts = state.canPlayHearts;
+	m_leadingCardSuit = state.leadingCardSuit;
+	m_trickLeader = state.trickLeader;
+	m_trickCards.clear();
+	m_playerOrder.clear();
+	for (int i = 0; i < state.trickSize; i++)
+	{
+		m_trickCards.push_back(BitHand::indexToCard(state.trickCards[i]));
+	}
+	if (!m_trickCards.empty())
+	{
+		for (int i = 0; i < numPlayers; i++)
+		{
+			m_playerOrder.push_back((state.trickLeader + i) % numPlayers);
+		}
+	}
+	m_playedCards.clear();
+	m_playedCardPlayers.clear();
+	for (int i = 0; i < state.numPlayedCards; i++)
+	{
+		m_playedCards.push_back(BitHand::indexToCard(state.playedCards[i]));
+		m_playedCardPlayers.push_back(state.playedCardPlayers[i]);
+	}
+	m_deck.setCardOrder(state.deckCards, state.deckSize);
+	m_deck.setGeneratorState(state.deckGeneratorState);
+}
+
+///<summary>
+///Determines whether a state can be restored into this game with setState(). Every count and seat must be in range for
+///this game's number of players, and every card must be a real card held in only one place: a hand, the trick in
+///progress, or the cards played this round. Each player must hold a full hand less the cards they have played, so no
+///seat is ever asked for a card it does not have. The deck must hold every card this game deals with, once each.
+///</summary>
+///<param name="state"> The state to check. </param>
+///<returns> True if the state is safe to restore, otherwise false. </returns>
+template <class Rules>
+bool BasicHeartsGame<Rules>::isValidState(const HeartsState &state)
+{
+	int numPlayers = m_players.size();
+	uint64_t allCards = (uint64_t(1) << 52) - 1;
+	uint64_t seenCards = 0;
+	uint64_t deckCards = 0;
+	int cardsPlayed[HeartsState::MAX_PLAYERS] = {};
+	// A state read from a file can hold any byte in a bool, and only 0 and 1 are safe to read as one
+	const bool *flags[] = { &state.isRoundInProgress, &state.isPassPending, &state.isFirstTrickOfRound, &state.canPlayHearts };
+	for (const bool *flag : flags)
+	{
+		uint8_t byte;
+		std::memcpy(&byte, flag, 1);
+		if (byte > 1)
 		{
-			titleText = "Playing Round";
+			return false;
 		}
-		HeartsGame::display(titleText);
-		HeartsGame::playTrick(playerOrder, trickCards, isFirstTrickOfGame);
+	}
+	if (state.numPlayers != numPlayers || state.roundsPlayed < 0)
+	{
+		return false;
+	}
+	if (state.trickSize < 0 || state.trickSize >= numPlayers || state.numPlayedCards < 0 || state.numPlayedCards > 52 || state.numPlayedCards % numPlayers != 0)
+	{
+		return false;
+	}
+	if (state.trickLeader < HeartsState::NO_LEADER || state.trickLeader >= numPlayers)
+	{
+		return false;
+	}
+	if (static_cast<int>(state.leadingCardSuit) > 3)
+	{
+		return false;
+	}
 
-		// Determine who won the trick so they can lead next trick and determine if points need to be allocated
-		int largestCardPos = HeartsGame::findPosOfWinningCardInTrick(trickCards);
-		nextLeadingPlayerPosition = playerOrder.at(largestCardPos);
-		m_players.at(nextLeadingPlayerPosition).addToAllPoints(HeartsGame::tallyPoints(trickCards));
-		if (isFirstTrickOfGame)
+	// Cards
+	for (int p = 0; p < numPlayers; p++)
+	{
+		if ((state.hands[p] & ~allCards) != 0 || (state.hands[p] & seenCards) != 0)
+		{
+			return false;
+		}
+		seenCards |= state.hands[p];
+	}
+	for (int i = 0; i < state.trickSize + state.numPlayedCards; i++)
+	{
+		int index = (i < state.trickSize) ? state.trickCards[i] : state.playedCards[i - state.trickSize];
+		if (index >= 52 || ((seenCards >> index) & 1) != 0)
 		{
-			isFirstTrickOfGame = false;
+			return false;
 		}
-		playerOrder.clear();
-		trickCards.clear();
+		seenCards |= uint64_t(1) << index;
 	}
-	// Handle the end of the round
-	HeartsGame::handleShootTheMoon();
-	HeartsGame::endRound();
+
+	// Who has played what
+	if (state.trickSize > 0 && state.trickLeader == HeartsState::NO_LEADER)
+	{
+		return false;
+	}
+	for (int i = 0; i < state.trickSize; i++)
+	{
+		cardsPlayed[(state.trickLeader + i) % numPlayers]++;
+	}
+	for (int i = 0; i < state.numPlayedCards; i++)
+	{
+		if (state.playedCardPlayers[i] >= numPlayers)
+		{
+			return false;
+		}
+		cardsPlayed[state.playedCardPlayers[i]]++;
+	}
+	for (int p = 0; p < numPlayers; p++)
+	{
+		// Between rounds every hand is empty and nothing has been played
+		int handSize = state.isRoundInProgress ? m_handSize : 0;
+		if (BitHand::countBits(state.hands[p]) + cardsPlayed[p] != handSize)
+		{
+			return false;
+		}
+	}
+	if ((state.isPassPending || state.isFirstTrickOfRound) && state.numPlayedCards != 0)
+	{
+		return false;
+	}
+	if (state.isPassPending && (!state.isRoundInProgress || state.trickSize != 0))
+	{
+		return false;
+	}
+	if (state.isRoundInProgress && !state.isFirstTrickOfRound && state.trickLeader == HeartsState::NO_LEADER)
+	{
+		return false;
+	}
+
+	// Deck
+	if (state.deckSize < 0 || state.deckSize > 52)
+	{
+		return false;
+	}
+	for (int i = 0; i < state.deckSize; i++)
+	{
+		if (state.deckCards[i] >= 52 || ((deckCards >> state.deckCards[i]) & 1) != 0)
+		{
+			return false;
+		}
+		deckCards |= uint64_t(1) << state.deckCards[i];
+	}
+	if (deckCards != (allCards & ~Rules::getRemovedCards(numPlayers).getBits()))
+	{
+		return false;
+	}
+	// xoshiro256** never leaves a state of all zeros
+	return (state.deckGeneratorState[0] | state.deckGeneratorState[1] | state.deckGeneratorState[2] | state.deckGeneratorState[3]) != 0;
+}
+
+///<summary> Saves the game to a file so it can be resumed later with loadState(). The file records which rules the game uses. </summary>
+///<param name="fileName"> Name of the file to write. </param>
+///<returns> True if the file was written, otherwise false. </returns>
+template <class Rules>
+bool BasicHeartsGame<Rules>::saveState(const std::string &fileName)
+{
+	HeartsState state = BasicHeartsGame::getState();
+	uint32_t size = sizeof(HeartsState);
+	uint32_t rulesTag = Rules::SAVE_TAG;
+	std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+	file.write("HRTS", 4);
+	file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+	file.write(reinterpret_cast<const char*>(&rulesTag), sizeof(rulesTag));
+	file.write(reinterpret_cast<const char*>(&state), sizeof(state));
+	return file.good();
+}
+
+///<summary> Resumes a game saved with saveState(). The game is left as it was if the file is rejected. </summary>
+///<param name="fileName"> Name of the file to read. </param>
+///<returns>
+///True if the game was restored, false if the file could not be read, was saved under different rules or with a different
+///number of players, or holds a state that isValidState() rejects.
+///</returns>
+template <class Rules>
+bool BasicHeartsGame<Rules>::loadState(const std::string &fileName)
+{
+	char magic[4] = {};
+	uint32_t size = 0;
+	uint32_t rulesTag = 0;
+	HeartsState state;
+	std::ifstream file(fileName, std::ios::binary);
+	file.read(magic, 4);
+	file.read(reinterpret_cast<char*>(&size), sizeof(size));
+	file.read(reinterpret_cast<char*>(&rulesTag), sizeof(rulesTag));
+	if (!file || std::memcmp(magic, "HRTS", 4) != 0 || size != sizeof(HeartsState) || rulesTag != Rules::SAVE_TAG)
+	{
+		return false;
+	}
+	file.read(reinterpret_cast<char*>(&state), sizeof(state));
+	if (!file || !BasicHeartsGame::isValidState(state))
+	{
+		return false;
+	}
+	BasicHeartsGame::setState(state);
+	return true;
+}
+
+///<summary> Lets a computer policy make the decisions for a seat. Passing nullptr gives the seat back to a human at the console. </summary>
+///<param name="playerIndex"> Index of the player in m_players. </param>
+///<param name="policy"> The policy to use for the seat. The HeartsGame does not take ownership of it. </param>
+///<returns> Nothing. </returns>
+template <class Rules>
+inline void BasicHeartsGame<Rules>::setPlayerPolicy(int playerIndex, PlayerPolicy *policy)
+{
+	m_policies.at(playerIndex) = policy;
+}
+
+///<summary> Turns headless mode on or off. A headless game does not read from or write to the console. </summary>
+///<param name="headless"> Whether the game should run headless. </param>
+///<returns> Nothing. </returns>
+template <class Rules>
+inline void BasicHeartsGame<Rules>::setHeadless(bool headless)
+{
+	m_headless = headless;
+	m_console.setHeadless(headless);
+}
+
+///<summary> Records every round played from now on into a game log. Passing nullptr stops recording. </summary>
+///<param name="gameLog"> An open log to write to. The HeartsGame does not take ownership of it. </param>
+///<returns> Nothing. </returns>
+template <class Rules>
+inline void BasicHeartsGame<Rules>::setGameLog(GameLogWriter *gameLog)
+{
+	m_gameLog = gameLog;
+}
+
+///<summary> Getter for the number of players in the game. </summary>
+///<returns> Number of players in the game. </returns>
+template <class Rules>
+inline int BasicHeartsGame<Rules>::getNumPlayers()
+{
+	return m_players.size();
+}
+
+///<summary> Getter for a player's total points in the game. </summary>
+///<param name="playerIndex"> Index of the player in m_players. </param>
+///<returns> The player's total points. </returns>
+template <class Rules>
+inline int BasicHeartsGame<Rules>::getPlayerPointsTotal(int playerIndex)
+{
+	return m_players.at(playerIndex).getPointsTotal();
 }
 
 ///<summary>
-///Display player's points and hands of cards on the console.
+///Plays a single round of Hearts. Meaning the entire deck is dealt and the round only ends when all players are out of cards.
+///If a round restored with setState() is still in progress, that round is finished instead of dealing a new one.
+///NOTE: Keeps asking a policy that is not ready until it is, so games with waiting seats should use playUntilWaiting() instead.
+///</summary>
+///<returns> Nothing. </returns>
+template <class Rules>
+void BasicHeartsGame<Rules>::playRound()
+{
+	if (!m_isRoundInProgress)
+	{
+		BasicHeartsGame::startRound();
+	}
+	while (m_isRoundInProgress)
+	{
+		BasicHeartsGame::playNextTrick();
+	}
+}
+
+///<summary> Deals a new round. The cards are passed by playNextTrick() before the first trick, once every seat is ready to pass. </summary>
+///<returns> Nothing. </returns>
+template <class Rules>
+void BasicHeartsGame<Rules>::startRound()
+{
+	if (!m_headless)
+	{
+		std::cin.ignore();
+	}
+	int passOffset = Rules::getPassOffset(m_roundsPlayed, m_players.size());
+	BasicHeartsGame::initializePlayerHands();
+	m_isRoundLogged = m_gameLog != nullptr;
+	if (m_isRoundLogged)
+	{
+		m_gameLog->beginRound(m_roundsPlayed == 0, passOffset);
+		for (size_t i = 0; i < m_players.size(); i++)
+		{
+			m_gameLog->recordHand(i, m_players.at(i).getRoundHandBits());
+		}
+	}
+	m_isPassPending = passOffset != 0;
+	m_isRoundInProgress = true;
+	m_isFirstTrick = true;
+	m_trickLeader = HeartsState::NO_LEADER;
+	m_playerOrder.clear();
+	m_trickCards.clear();
+}
+
+///<summary>
+///Plays the rest of the trick in progress, or a whole new trick, then scores it. Ends the round after its last trick.
+///The cards are passed first if that has not happened yet this round.
+///The trick is kept in members rather than locals so a game restored in the middle of a trick carries on from the same card.
+///If a policy is not ready the trick stops part way with m_isWaiting set, and the next call picks it up again.
+///</summary>
+///<returns> Nothing. </returns>
+template <class Rules>
+void BasicHeartsGame<Rules>::playNextTrick()
+{
+	std::string titleText;
+	m_isWaiting = false;
+	if (m_isPassPending)
+	{
+		if (!BasicHeartsGame::passCards(Rules::getPassOffset(m_roundsPlayed, m_players.size())))
+		{
+			m_isWaiting = true;
+			return;
+		}
+		m_isPassPending = false;
+	}
+	// Need to initialize player order first, then play the trick
+	if (m_trickCards.empty())
+	{
+		m_playerOrder.clear();
+		BasicHeartsGame::initializePlayerOrder(m_playerOrder, m_isFirstTrick, m_trickLeader);
+	}
+	if (m_isFirstTrick)
+	{
+		titleText = "Playing Round - Must begin with: " + std::string(m_startingCard.getDescription());
+	}
+	else
+	{
+		titleText = "Playing Round";
+	}
+	BasicHeartsGame::display(titleText);
+	BasicHeartsGame::playTrick(m_playerOrder, m_trickCards, m_isFirstTrick);
+	if (m_isWaiting)
+	{
+		return;
+	}
+
+	// Determine who won the trick so they can lead next trick and determine if points need to be allocated
+	int largestCardPos = BasicHeartsGame::findPosOfWinningCardInTrick(m_trickCards);
+	m_trickLeader = m_playerOrder.at(largestCardPos);
+	m_players.at(m_trickLeader).addToAllPoints(BasicHeartsGame::tallyPoints(m_trickCards));
+	// Rule bonuses go straight onto the total so points this round stay the Hearts and Queen that shooting the moon counts
+	if constexpr (Rules::JACK_OF_DIAMONDS_POINTS != 0)
+	{
+		if (std::find(m_trickCards.begin(), m_trickCards.end(), Card(9, Card::Suit::DIAMONDS)) != m_trickCards.end())
+		{
+			m_players.at(m_trickLeader).addToPointsTotal(Rules::JACK_OF_DIAMONDS_POINTS);
+		}
+	}
+	m_playedCards.insert(m_playedCards.end(), m_trickCards.begin(), m_trickCards.end());
+	m_playedCardPlayers.insert(m_playedCardPlayers.end(), m_playerOrder.begin(), m_playerOrder.end());
+	if (m_isRoundLogged)
+	{
+		m_gameLog->recordTrick(m_trickCards);
+	}
+	m_isFirstTrick = false;
+	m_playerOrder.clear();
+	m_trickCards.clear();
+
+	// Keep playing until players run out of cards, then handle the end of the round
+	if (m_players.at(0).getRoundHandBits().isEmpty())
+	{
+		if (m_isRoundLogged)
+		{
+			m_pointsThisRound.clear();
+			for (size_t i = 0; i < m_players.size(); i++)
+			{
+				m_pointsThisRound.push_back(m_players.at(i).getPointsThisRound());
+			}
+			m_gameLog->endRound(m_pointsThisRound);
+		}
+		BasicHeartsGame::handleShootTheMoon();
+		BasicHeartsGame::endRound();
+		m_isRoundInProgress = false;
+	}
+}
+
+///<summary>
+///Display player's points and hands of cards on the console. Nothing is displayed when the game is headless.
 ///</summary>
 ///<param name="title"> Title to go with the player's cards to denote which part of the game is happening. </param>
 ///<returns> Nothing. </returns>
-void HeartsGame::display(std::string title)
+template <class Rules>
+void BasicHeartsGame<Rules>::display(std::string title)
 {
-	system("cls");
+	if (m_headless)
+	{
+		return;
+	}
+	m_console.beginFrame();
+	std::ostream &screen = m_console.frame();
 	int numPlayers = m_players.size();
 	int handSize = m_players.at(0).getRoundHand().size(); // all hand sizes are the same
 	std::string tempStr;
 
 	if (!title.empty())
 	{
-		std::cout << title << '\n';
+		screen << title << '\n';
 	}
-	std::cout << std::left;
+	screen << std::left;
 	for (int i = 0; i < numPlayers; i++)
 	{
 		tempStr = "Player " + std::to_string(i + 1);
-		std::cout << std::setw(15) << tempStr;
+		screen << std::setw(15) << tempStr;
 	}
-	std::cout << '\n';
+	screen << '\n';
 	for (int i = 0; i < numPlayers; i++)
 	{
-		std::cout << std::setw(15) << "==========";
+		screen << std::setw(15) << "==========";
 	}
-	std::cout << '\n';
+	screen << '\n';
 	for (size_t i = 0; i < numPlayers; i++)
 	{
 		std::string ptsStr = "Points: " + std::to_string(m_players.at(i).getPointsTotal());
-		std::cout << std::setw(15) << ptsStr;
+		screen << std::setw(15) << ptsStr;
 	}
-	std::cout << '\n';
+	screen << '\n';
 	for (int i = 0; i < numPlayers; i++)
 	{
-		std::cout << std::setw(15) << "==========";
+		screen << std::setw(15) << "==========";
 	}
-	std::cout << '\n';
+	screen << '\n';
 	for (int i = 0; i < handSize; i++)
 	{
 		for (int j = 0; j < numPlayers; j++)
 		{
-			std::cout << std::setw(15) << std::left << m_players.at(j).getRoundHand().at(i).getDescription();
+			const std::vector<Card> &hand = m_players.at(j).getRoundHand();
+			screen << std::setw(15) << std::left << hand.at(i).getDescription();
 		}
-		std::cout << '\n';
+		screen << '\n';
 	}
+	m_console.present();
+}
+
+///<summary> Getter for how many times a player has shot the moon this game. </summary>
+///<param name="playerIndex"> Index of the player in m_players. </param>
+///<returns> Number of rounds the player shot the moon. </returns>
+template <class Rules>
+inline int BasicHeartsGame<Rules>::getShootTheMoonCount(int playerIndex)
+{
+	return m_shootTheMoonCounts.at(playerIndex);
+}
+
+///<summary> Getter for the number of rounds played so far this game. </summary>
+///<returns> Number of rounds played. </returns>
+template <class Rules>
+inline int BasicHeartsGame<Rules>::getRoundsPlayed()
+{
+	return m_roundsPlayed;
+}
+
+///<summary> Seeds the deck so the deals of this game can be reproduced. Games with different seeds share no random state. </summary>
+///<param name="seed"> Seed for the deck's random number generator. </param>
+///<returns> Nothing. </returns>
+template <class Rules>
+inline void BasicHeartsGame<Rules>::setSeed(unsigned int seed)
+{
+	m_deck.setSeed(seed);
 }
 
 ///<summary> Determines whether the number of players is valid for a game of Hearts. </summary>
 ///<param name="numPlayers"> Number of players in the game. </param>
 ///<returns> True if the number of players is 3, 4, or 5, otherwise false. </returns>
-inline bool HeartsGame::isValidNumberOfPlayers(int numPlayers)
+template <class Rules>
+inline bool BasicHeartsGame<Rules>::isValidNumberOfPlayers(int numPlayers)
 {
 	if (numPlayers >= 3 && numPlayers <= 5)
 	{
@@ -230,6 +794,24 @@ inline bool HeartsGame::isValidNumberOfPlayers(int numPlayers)
 	}
 }
 
+///<summary> Gets the card that has to lead the first trick of every round under this game's rules. </summary>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<returns> The starting card. </returns>
+template <class Rules>
+inline Card BasicHeartsGame<Rules>::getStartingCard(int numPlayers)
+{
+	return Rules::getStartingCard(numPlayers);
+}
+
+///<summary> Gets the cards taken out of the deck so that it can be dealt evenly under this game's rules. </summary>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<returns> The cards removed from the deck. </returns>
+template <class Rules>
+inline BitHand BasicHeartsGame<Rules>::getRemovedCards(int numPlayers)
+{
+	return Rules::getRemovedCards(numPlayers);
+}
+
 ///<summary> 
 ///Finds the position of the player with the starting card in their round hand at the beginning of a round. 
 ///3 players - Staring card is 2 of Clubs
@@ -237,13 +819,13 @@ inline bool HeartsGame::isValidNumberOfPlayers(int numPlayers)
 ///5 players - Starting card is 3 of Clubs
 ///</summary>
 ///<returns> The numeric position in the vector holding the players telling which player has the starting card in their hand.. </returns>
-int HeartsGame::findStartingRoundPlayerPos()
+template <class Rules>
+int BasicHeartsGame<Rules>::findStartingRoundPlayerPos()
 {
 	int pos = 0;
 	for (size_t i = 0; i < m_players.size(); i++)
 	{
-		pos = Deck::findPositionOfCard(m_players.at(i).getRoundHand(), m_startingCard);
-		if (pos != -1)
+		if (m_players.at(i).getRoundHandBits().hasCard(m_startingCard))
 		{
 			pos = i;
 			break;
@@ -254,36 +836,57 @@ int HeartsGame::findStartingRoundPlayerPos()
 
 ///<summary> Used at the beginning of each round to shuffle the deck and deal players their round hands. </summary>
 ///<returns> Nothing. </returns>
-void HeartsGame::initializePlayerHands()
+template <class Rules>
+void BasicHeartsGame<Rules>::initializePlayerHands()
 {
 	m_deck.shuffle();
-	std::vector<std::vector<Card>> handCollection = m_deck.deal(m_players.size(), m_handSize);
+	m_deck.dealSorted(m_players.size(), m_handSize, m_dealtHands);
 	for (int i = 0; i < m_players.size(); i++)
 	{
-		m_players.at(i).setRoundHand(handCollection.at(i));
+		m_players.at(i).setRoundHand(m_dealtHands.at(i));
 	}
 }
 
 ///<summary> 
-///Handles the card passing phase that begins at the start of each round where each player selects 3 cards to pass to the player to their right. 
-///E.g., player 1 selects 3 cards and passes to player 2, etc.
-///Last player passes to the first player
+///Handles the card passing phase that begins at the start of each round where each player selects 3 cards to pass to another player. 
+///E.g., with an offset of 1 player 1 selects 3 cards and passes to player 2, etc.
+///Counting wraps around, so with an offset of 1 the last player passes to the first player
+///Nothing is passed until every computer seat is ready, so that no seat's cards change while another is still choosing.
 ///</summary>
-///<returns> Nothing. </returns>
-void HeartsGame::passCards()
+///<param name="passOffset"> Each player passes to the player this many seats after them. </param>
+///<returns> True if the cards were passed, false if a policy is not ready yet. </returns>
+template <class Rules>
+bool BasicHeartsGame<Rules>::passCards(int passOffset)
 {
 	std::vector<std::vector<Card>> passedCards;
 	std::string cardStr;
 	int numPlayers = m_players.size();
+	bool isReady = true;
+	// Ask every seat, not just up to the first that is not ready, so they can all start choosing at once
+	for (int i = 0; i < numPlayers; i++)
+	{
+		if (m_policies.at(i) != nullptr && !m_policies.at(i)->isReadyToPass(m_players.at(i).getRoundHand(), i, numPlayers, passOffset, 3))
+		{
+			isReady = false;
+		}
+	}
+	if (!isReady)
+	{
+		return false;
+	}
 	// For each player ask them to select 3 cards to pass
 	passedCards.resize(numPlayers);
 	for (size_t i = 0; i < numPlayers; i++)
 	{
-		system("cls");
+		if (m_policies.at(i) != nullptr)
+		{
+			passedCards.at(i) = m_policies.at(i)->chooseCardsToPass(m_players.at(i).getRoundHand(), i, numPlayers, passOffset, 3);
+			continue;
+		}
 		// Display all cards
-		HeartsGame::display("Passing Cards");
+		BasicHeartsGame::display("Passing Cards");
 		std::cout << '\n';
-		std::cout << "Player " << i + 1 << '\n';
+		std::cout << "Player " << i + 1 << " passing to Player " << (i + passOffset) % numPlayers + 1 << '\n';
 		// Select the 3 cards for one player
 		for (size_t j = 0; j < 3; j++)
 		{
@@ -299,11 +902,11 @@ void HeartsGame::passCards()
 					{
 						throw InvalidCardPlayed(InvalidCardPlayed::ExceptionType::NONEXISTENT_CARD);
 					}
-					if (!Deck::isCardInCollection(m_players.at(i).getRoundHand(), cardStr))
+					if (!m_players.at(i).getRoundHandBits().hasCard(Deck::convertCardStrToCard(cardStr)))
 					{
 						throw InvalidCardPlayed(InvalidCardPlayed::ExceptionType::CARD_IN_HAND);
 					}
-					if (HeartsGame::isDuplicatePassedCard(passedCards.at(i), cardStr))
+					if (BasicHeartsGame::isDuplicatePassedCard(passedCards.at(i), cardStr))
 					{
 						throw InvalidCardPlayed(InvalidCardPlayed::ExceptionType::DUPLICATE_CARD);
 					}
@@ -322,19 +925,15 @@ void HeartsGame::passCards()
 	// Once all cards are selected, remove them from appropriate owner
 	for (size_t i = 0; i < numPlayers; i++)
 	{
-		int swapPlayer;
-		// The last player passes their cards to the first player
-		if (i == numPlayers - 1)
+		if (m_isRoundLogged)
 		{
-			swapPlayer = 0;
-		}
-		else
-		{
-			swapPlayer = i + 1;
+			m_gameLog->recordPass(i, passedCards.at(i));
 		}
+		int swapPlayer = (i + passOffset) % numPlayers;
 		m_players.at(i).removeCardsInRoundHand(passedCards.at(i));
 		m_players.at(swapPlayer).addCardsToRoundHand(passedCards.at(i));
 	}
+	return true;
 }
 
 ///<summary> 
@@ -342,63 +941,55 @@ void HeartsGame::passCards()
 ///Note that all Hearts are worth 1 point and the Queen of Spades is worth 13 points.
 ///</summary>
 ///<returns> The number of points available in the collection of cards. </returns>
-int HeartsGame::tallyPoints(std::vector<Card> &cards)
+template <class Rules>
+int BasicHeartsGame<Rules>::tallyPoints(const std::vector<Card> &cards)
 {
-	int points = 0;
-	for (Card &card : cards)
+	uint8_t packedCards[TrickScorer::MAX_PLAYERS];
+	int numCards = (cards.size() < TrickScorer::MAX_PLAYERS) ? static_cast<int>(cards.size()) : TrickScorer::MAX_PLAYERS;
+	for (int i = 0; i < numCards; i++)
 	{
-		if (card.getSuit() == Card::Suit::HEARTS)
-		{
-			points++;
-		}
-		else if (card == Card(10, Card::Suit::SPADES)) // Queen of Spades
-		{
-			points = points + 13;
-		}
+		packedCards[i] = cards.at(i).getIndex();
 	}
-	return points;
+	return TrickScorer::tallyPoints(packedCards, numCards);
 }
 
 ///<summary> 
 ///Determines whether a given card played during a trick is valid or not. 
+///Valid cards are accepted straight from legalMoves(). For an invalid card the reason is worked out and shown to the player.
 ///</summary>
 ///<param name="card"> The card played. </param>
 ///<param name="playerIndex"> Index of the player in m_players who is playing a card. </param>
-///<param name="canLeadQofS"> Whether the player can lead with the Queen of Spades or not. </param>
-///<param name="isFirstTrickOfGame"> Whether this is the first trick of the game or not. </param>
-///<param name="isLeadingCard"> Whether the card being played is the leading card of the trick or not. </param>
+///<param name="trickState"> The state of the trick the card is played into. </param>
 ///<returns> True if the card is valid to play during the trick, otherwise false. </returns>
-bool HeartsGame::isValidCardPlay(Card &card, int playerIndex, bool canLeadQofS, bool isFirstTrickOfGame, bool isLeadingCard)
+template <class Rules>
+bool BasicHeartsGame<Rules>::isValidCardPlay(Card &card, int playerIndex, const TrickState &trickState)
 {
 	bool result;
-	if (card.getSuit() == Card::Suit::HEARTS)
+	BitHand hand = m_players.at(playerIndex).getRoundHandBits();
+	if (BasicHeartsGame::legalMoves(hand, trickState).hasCard(card))
 	{
-		HeartsGame::setCanPlayHearts(playerIndex, isLeadingCard);
+		return true;
 	}
-	
+
 	try
 	{
-		if (!Deck::isCardInCollection(m_players.at(playerIndex).getRoundHand(), card))
+		if (!hand.hasCard(card))
 		{
 			throw InvalidCardPlayed(InvalidCardPlayed::ExceptionType::CARD_IN_HAND);
 		}
-		else if (isFirstTrickOfGame && isLeadingCard && card != m_startingCard)
+		else if (trickState.isFirstTrickOfRound && trickState.isLeadingCard && card != trickState.startingCard)
 		{
 			throw InvalidCardPlayed(InvalidCardPlayed::ExceptionType::BAD_LEADING_CARD);
 		}
-		else if (!canLeadQofS && card == Card(10, Card::Suit::SPADES))
+		else if (!trickState.canLeadQofS && BitHand::cardBit(card) == QUEEN_OF_SPADES_BIT)
 		{
 			throw InvalidCardPlayed(InvalidCardPlayed::ExceptionType::CAN_LEAD_QUEEN_OF_SPADES);
 		}
-		else if (!m_canPlayHearts && card.getSuit() == Card::Suit::HEARTS)
-		{
-			throw InvalidCardPlayed(InvalidCardPlayed::ExceptionType::CAN_HEARTS_BE_PLAYED);
-		}
-		else if (!isLeadingCard && card.getSuit() != m_leadingCardSuit && Deck::hasOneCardOfSuitType(m_players.at(playerIndex).getRoundHand(), m_leadingCardSuit))
+		else if (!trickState.isLeadingCard && card.getSuit() != trickState.leadingCardSuit && hand.hasSuit(trickState.leadingCardSuit))
 		{
 			throw InvalidCardPlayed(InvalidCardPlayed::ExceptionType::NOT_SAME_SUIT);
 		}
-		result = true;
+		throw InvalidCardPlayed(InvalidCardPlayed::ExceptionType::CAN_HEARTS_BE_PLAYED);
 	}
 	catch (InvalidCardPlayed &icp)
 	{
@@ -408,25 +999,124 @@ bool HeartsGame::isValidCardPlay(Card &card, int playerIndex, bool canLeadQofS,
 	return result;
 }
 
+///<summary> 
+///Finds every card a player may play right now. Does not print anything or change the game state.
+///</summary>
+///<param name="playerIndex"> Index of the player in m_players who is playing a card. </param>
+///<param name="trickState"> The state of the trick the card would be played into. </param>
+///<returns> The playable cards as a BitHand. </returns>
+template <class Rules>
+inline BitHand BasicHeartsGame<Rules>::legalMoves(int playerIndex, const TrickState &trickState)
+{
+	return BasicHeartsGame::legalMoves(m_players.at(playerIndex).getRoundHandBits(), trickState);
+}
+
+///<summary> 
+///Finds every card in a hand that may be played into a trick. Each rule is a mask over the hand, so nothing is copied, searched, or thrown.
+///1. The first card of the round must be the starting card.
+///2. The Queen of Spades cannot be played when the trick state forbids it.
+///3. Players must follow the leading suit if they can.
+///4. Hearts cannot be led until they are broken. A Heart can always be thrown away when the player has none of the leading suit.
+///If none of the cards pass the rules (e.g., a leading player holding only Hearts before they are broken), the whole hand is playable.
+///</summary>
+///<param name="hand"> The cards held by the player. </param>
+///<param name="trickState"> The state of the trick the card would be played into. </param>
+///<returns> The playable cards as a BitHand. </returns>
+template <class Rules>
+BitHand BasicHeartsGame<Rules>::legalMoves(BitHand hand, const TrickState &trickState)
+{
+	uint64_t handBits = hand.getBits();
+	uint64_t playable = handBits;
+
+	if (trickState.isFirstTrickOfRound && trickState.isLeadingCard)
+	{
+		playable &= BitHand::cardBit(trickState.startingCard);
+	}
+	if (!trickState.canLeadQofS)
+	{
+		playable &= ~QUEEN_OF_SPADES_BIT;
+	}
+	if (!trickState.isLeadingCard && (handBits & BitHand::suitMask(trickState.leadingCardSuit)))
+	{
+		playable &= BitHand::suitMask(trickState.leadingCardSuit);
+	}
+	if (!trickState.canPlayHearts && trickState.isLeadingCard)
+	{
+		playable &= ~HEARTS_BITS;
+	}
+	if (playable == 0)
+	{
+		playable = handBits;
+	}
+	return BitHand(playable);
+}
+
+///<summary> 
+///Gathers the current game state into a TrickState for legalMoves().
+///</summary>
+///<param name="isFirstTrickOfGame"> Whether this is the first trick of the game or not. </param>
+///<param name="isLeadingCard"> Whether the card being played is the leading card of the trick or not. </param>
+///<param name="canLeadQofS"> Whether the player can lead with the Queen of Spades or not. </param>
+///<returns> The TrickState for the card about to be played. </returns>
+template <class Rules>
+TrickState BasicHeartsGame<Rules>::getTrickState(bool isFirstTrickOfGame, bool isLeadingCard, bool canLeadQofS)
+{
+	TrickState trickState;
+	trickState.isFirstTrickOfRound = isFirstTrickOfGame;
+	trickState.isLeadingCard = isLeadingCard;
+	trickState.canPlayHearts = m_canPlayHearts;
+	trickState.canLeadQofS = canLeadQofS;
+	trickState.leadingCardSuit = m_leadingCardSuit;
+	trickState.startingCard = m_startingCard;
+	return trickState;
+}
+
+///<summary> 
+///Asks the PlayerPolicy of a seat which card to play.
+///</summary>
+///<param name="playerIndex"> Index of the player in m_players who is playing a card. </param>
+///<param name="playerOrder"> The order in which players go for this trick. </param>
+///<param name="trickCards"> The cards played so far this trick. </param>
+///<param name="trickState"> The state of the trick the card is played into. </param>
+///<param name="card"> Set to the card chosen by the policy. </param>
+///<returns> True if the policy chose a card, false if it is not ready yet. </returns>
+template <class Rules>
+bool BasicHeartsGame<Rules>::choosePolicyCard(int playerIndex, const std::vector<int> &playerOrder, const std::vector<Card> &trickCards, const TrickState &trickState, Card &card)
+{
+	const std::vector<Card> &hand = m_players.at(playerIndex).getRoundHand();
+	BasicHeartsGame::legalMoves(playerIndex, trickState).toVector(m_playableCards);
+	m_pointsThisRound.clear();
+	for (size_t i = 0; i < m_players.size(); i++)
+	{
+		m_pointsThisRound.push_back(m_players.at(i).getPointsThisRound());
+	}
+	int passOffset = Rules::getPassOffset(m_roundsPlayed, m_players.size());
+	PlayView view = { playerIndex, static_cast<int>(m_players.size()), passOffset, trickState, hand, m_playableCards, trickCards, playerOrder, m_playedCards, m_playedCardPlayers, m_pointsThisRound };
+	if (!m_policies.at(playerIndex)->isReadyToPlay(view))
+	{
+		return false;
+	}
+	card = m_policies.at(playerIndex)->chooseCardToPlay(view);
+	return true;
+}
+
 ///<summary> 
 ///Finds the position of the winning card for a given trick.
 ///Note that the winning card must be of the same suit as the leading card
 ///</summary>
 ///<param name="trickCards"> The vector of cards played during a given trick. </param>
 ///<returns> The position of the winning card in the given trick cards. </returns>
-int HeartsGame::findPosOfWinningCardInTrick(std::vector<Card> &trickCards)
+template <class Rules>
+int BasicHeartsGame<Rules>::findPosOfWinningCardInTrick(const std::vector<Card> &trickCards)
 {
-	int pos = 0;
-	std::vector<Card> cardsOfLeadingSuit;
-	for (size_t i = 0; i < trickCards.size() - 1; i++)
+	// Cards that don't start with the leading suit cannot win a trick. Within a suit a higher bit index is a higher card
+	uint8_t packedCards[TrickScorer::MAX_PLAYERS];
+	int numCards = (trickCards.size() < TrickScorer::MAX_PLAYERS) ? static_cast<int>(trickCards.size()) : TrickScorer::MAX_PLAYERS;
+	for (int i = 0; i < numCards; i++)
 	{
-		// Cards that don't start with the leading suit cannot win a trick
-		if (trickCards.at(i + 1).getSuit() == m_leadingCardSuit && trickCards.at(pos) < trickCards.at(i + 1))
-		{
-			pos = i + 1;
-		}
+		packedCards[i] = trickCards.at(i).getIndex();
 	}
-	return pos;
+	return TrickScorer::findWinningPosition(packedCards, numCards);
 }
 
 ///<summary> 
@@ -439,12 +1129,13 @@ int HeartsGame::findPosOfWinningCardInTrick(std::vector<Card> &trickCards)
 ///<param name="isFirstTrickOfGame"> Whether or not it is the first trick of the game. </param>
 ///<param name="leadingPlayerPosition"> The position of the player that won the previous trick. Only needed after the first round of the game.</param>
 ///<returns> Return is done in the playerOrder variable. </returns>
-void HeartsGame::initializePlayerOrder(std::vector<int> &playerOrder, bool isFirstTrickOfGame, int leadingPlayerPosition)
+template <class Rules>
+void BasicHeartsGame<Rules>::initializePlayerOrder(std::vector<int> &playerOrder, bool isFirstTrickOfGame, int leadingPlayerPosition)
 {
 	int leadPosition;
 	if (isFirstTrickOfGame)
 	{
-		leadPosition = HeartsGame::findStartingRoundPlayerPos();
+		leadPosition = BasicHeartsGame::findStartingRoundPlayerPos();
 	}
 	else
 	{
@@ -478,52 +1169,65 @@ void HeartsGame::initializePlayerOrder(std::vector<int> &playerOrder, bool isFir
 ///<param name="trickCards"> Output to let the round handler know which cards were played this trick. </param>
 ///<param name="isFirstTrickOfGame"> Whether or not it is the first trick of the game. </param>
 ///<returns> Nothing. </returns>
-void HeartsGame::playTrick(std::vector<int> playerOrder, std::vector<Card> &trickCards, bool isFirstTrickOfGame)
+template <class Rules>
+void BasicHeartsGame<Rules>::playTrick(const std::vector<int> &playerOrder, std::vector<Card> &trickCards, bool isFirstTrickOfGame)
 {
 	bool canLeadQofS = true;
-	for (int i = 0; i < m_players.size(); i++)
+	// A restored game can be part way through the trick, so start after the cards already played
+	for (int i = static_cast<int>(trickCards.size()); i < static_cast<int>(m_players.size()); i++)
 	{
 		std::string cardStr;
 		bool validCardPlay = false;
 		Card playedCard;
-		if (isFirstTrickOfGame && i == 0 && !Deck::hasOneCardOfSuitType(m_players.at(playerOrder.at(i)).getRoundHand(), Card::Suit::CLUBS))
+		if (isFirstTrickOfGame && i == 0 && !m_players.at(playerOrder.at(i)).getRoundHandBits().hasSuit(Card::Suit::CLUBS))
 		{
 			canLeadQofS = false;
 		}
-		do
+		TrickState trickState = BasicHeartsGame::getTrickState(isFirstTrickOfGame, i == 0, canLeadQofS);
+		if (m_policies.at(playerOrder.at(i)) != nullptr)
 		{
-			std::cout << "Player " << playerOrder.at(i) + 1 << '\n';
-			std::cout << "Enter a card: ";
-			std::getline(std::cin, cardStr);
-			try
+			if (!BasicHeartsGame::choosePolicyCard(playerOrder.at(i), playerOrder, trickCards, trickState, playedCard))
+			{
+				m_isWaiting = true;
+				return;
+			}
+			m_console.frame() << "Player " << playerOrder.at(i) + 1 << " plays " << playedCard.getDescription() << '\n';
+			m_console.present();
+		}
+		else
+		{
+			do
 			{
-				if (!Deck::isCardStringValid(cardStr))
+				std::cout << "Player " << playerOrder.at(i) + 1 << '\n';
+				std::cout << "Enter a card: ";
+				std::getline(std::cin, cardStr);
+				try
 				{
-					throw InvalidCardPlayed(InvalidCardPlayed::ExceptionType::NONEXISTENT_CARD);
+					if (!Deck::isCardStringValid(cardStr))
+					{
+						throw InvalidCardPlayed(InvalidCardPlayed::ExceptionType::NONEXISTENT_CARD);
+					}
+					playedCard = Deck::convertCardStrToCard(cardStr);
+					validCardPlay = BasicHeartsGame::isValidCardPlay(playedCard, playerOrder.at(i), trickState);
 				}
-				playedCard = Deck::convertCardStrToCard(cardStr);
- 
-				if (!HeartsGame::isValidCardPlay(playedCard, playerOrder.at(i), canLeadQofS, isFirstTrickOfGame, i == 0))
+				catch (InvalidCardPlayed &icp)
 				{
 					validCardPlay = false;
+					std::cout << icp.getErrorDescription() << '\n';
 				}
-				else
-				{
-					validCardPlay = true;
-					if (i == 0)
-					{
-						HeartsGame::setLeadingCardSuit(playedCard.getSuit());
-					}
-				}
-			}
-			catch (InvalidCardPlayed &icp)
-			{
-				validCardPlay = false;
-				std::cout << icp.getErrorDescription() << '\n';
-			}
 
-		} while (!validCardPlay);
+			} while (!validCardPlay);
+		}
 
+		if (i == 0)
+		{
+			BasicHeartsGame::setLeadingCardSuit(playedCard.getSuit());
+		}
+		// Only legal cards reach this point, so any Heart played means Hearts are now broken
+		if (playedCard.getSuit() == Card::Suit::HEARTS)
+		{
+			m_canPlayHearts = true;
+		}
 		trickCards.push_back(playedCard);
 		m_players.at(playerOrder.at(i)).removeCardInRoundHand(playedCard);
 	}
@@ -534,35 +1238,25 @@ void HeartsGame::playTrick(std::vector<int> playerOrder, std::vector<Card> &tric
 ///</summary>
 ///<param name="suit"> The suit of the leading card for a given trick. </param>
 ///<returns> Nothing. </returns>
-void HeartsGame::setLeadingCardSuit(Card::Suit suit)
+template <class Rules>
+void BasicHeartsGame<Rules>::setLeadingCardSuit(Card::Suit suit)
 {
 	m_leadingCardSuit = suit;
 }
 
-///<summary> 
-///Sets the game variable for whether players can play Hearts in a given round. It does so by determing whether a player can play a Heart card in a given trick.
-///Hearts can only be played when a player that is not leading plays a Heart where the leading card is a different suit. 
-///(i.e., the non-leading player does not have any cards of the leading suit left)
-///</summary>
-///<param name="playerIndex"> Index of the player playing their card this trick. </param>
-///<param name="isLeadingCard"> Whether or not the card being played is the leading one. </param>
-///<returns> Nothing. </returns>
-void HeartsGame::setCanPlayHearts(int playerIndex, bool isLeadingCard)
-{
-	if (!isLeadingCard && !Deck::hasOneCardOfSuitType(m_players.at(playerIndex).getRoundHand(), m_leadingCardSuit))
-	{
-		m_canPlayHearts = true;
-	}
-}
-
 ///<summary> 
 ///Handles the shooting the moon scenario at the end of each round.
 ///"Shooting the moon" only happens when a player that round wins all Hearts cards and the Queen of Spades. 
 ///If this is true then the player that "shoots the moon" receives zero points and all other players get 26 points.
 ///</summary>
 ///<returns> Nothing. </returns>
-void HeartsGame::handleShootTheMoon()
+template <class Rules>
+void BasicHeartsGame<Rules>::handleShootTheMoon()
 {
+	if constexpr (!Rules::CAN_SHOOT_THE_MOON)
+	{
+		return;
+	}
 	int position = -1;
 	for (size_t i = 0; i < m_players.size(); i++)
 	{
@@ -575,6 +1269,7 @@ void HeartsGame::handleShootTheMoon()
 	}
 	if (position != -1)
 	{
+		m_shootTheMoonCounts.at(position)++;
 		for (size_t i = 0; i < m_players.size(); i++)
 		{
 			if (i == position)
@@ -595,7 +1290,8 @@ void HeartsGame::handleShootTheMoon()
 ///Cleans up player variables for the end of the round so that Player objects will be ready for the next round.
 ///</summary>
 ///<returns> Nothing. </returns>
-void HeartsGame::endRound()
+template <class Rules>
+void BasicHeartsGame<Rules>::endRound()
 {
 	for (size_t i = 0; i < m_players.size(); i++)
 	{
@@ -604,6 +1300,9 @@ void HeartsGame::endRound()
 		m_players.at(i).clearRoundHand();
 	}
 	m_canPlayHearts = false;
+	m_playedCards.clear();
+	m_playedCardPlayers.clear();
+	m_roundsPlayed++;
 }
 
 ///<summary> 
@@ -612,10 +1311,11 @@ void HeartsGame::endRound()
 ///<param name="passedCards"> The vector of cards already selected for passing. </param>
 ///<param name="cardStr"> A string representing the Card object that is being selected. </param>
 ///<returns> True if card selected has been selected previously, otherwise false. </returns>
-bool HeartsGame::isDuplicatePassedCard(std::vector<Card> &passedCards, std::string cardStr)
+template <class Rules>
+bool BasicHeartsGame<Rules>::isDuplicatePassedCard(const std::vector<Card> &passedCards, const std::string &cardStr)
 {
 	Card chosenCard = Deck::convertCardStrToCard(cardStr);
-	std::vector<Card>::iterator it = std::find(passedCards.begin(), passedCards.end(), chosenCard);
+	std::vector<Card>::const_iterator it = std::find(passedCards.begin(), passedCards.end(), chosenCard);
 	return (it != passedCards.end());
 }
 
@@ -0,0 +1,93 @@
+#ifndef HEARTSRULES_H
+#define HEARTSRULES_H
+#include "Card.h"
+#include "BitHand.h"
+
+///<summary>
+///Rule set that BasicHeartsGame is compiled against. A rule set is a struct of constants and static functions, so every
+///rule check in the game is a constant the compiler folds away and each variant gets its own specialized game.
+///Variants derive from StandardRules and hide only the members they change, apart from SAVE_TAG, which every rule set gives a value of its own.
+///</summary>
+struct StandardRules
+{
+	static constexpr int JACK_OF_DIAMONDS_POINTS = 0;	// Added to the total of whoever takes the Jack of Diamonds
+	static constexpr bool CAN_SHOOT_THE_MOON = true;
+	static constexpr uint32_t SAVE_TAG = 1;	// Written to saved games so a game is only resumed under the rules it was saved with
+
+	static int getPassOffset(int roundIndex, int numPlayers);
+	static Card getStartingCard(int numPlayers);
+	static BitHand getRemovedCards(int numPlayers);
+};
+
+///<summary> Omnibus Hearts: taking the Jack of Diamonds takes 10 points off a player's total. </summary>
+struct OmnibusRules : StandardRules
+{
+	static constexpr int JACK_OF_DIAMONDS_POINTS = -10;
+	static constexpr uint32_t SAVE_TAG = 2;
+};
+
+///<summary> Hearts without shooting the moon: a player who takes every point card simply keeps the 26 points. </summary>
+struct NoShootRules : StandardRules
+{
+	static constexpr bool CAN_SHOOT_THE_MOON = false;
+	static constexpr uint32_t SAVE_TAG = 3;
+};
+
+///<summary>
+///Gets which way cards are passed in a round. Passing rotates left, right, across, then a round where cards are held.
+///Across only exists with an even number of players, so 3 and 5 players rotate left, right, hold.
+///</summary>
+///<param name="roundIndex"> Number of rounds already played in the game. </param>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<returns> Each player passes to the player this many seats after them. 0 when cards are held. </returns>
+inline int StandardRules::getPassOffset(int roundIndex, int numPlayers)
+{
+	if (numPlayers % 2 == 0)
+	{
+		const int offsets[] = { 1, numPlayers - 1, numPlayers / 2, 0 };
+		return offsets[roundIndex % 4];
+	}
+	const int offsets[] = { 1, numPlayers - 1, 0 };
+	return offsets[roundIndex % 3];
+}
+
+///<summary>
+///Gets the card that has to lead the first trick of every round.
+///3 players - Staring card is 2 of Clubs
+///4 players - Starting card is 2 of Clubs
+///5 players - Starting card is 3 of Clubs
+///</summary>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<returns> The starting card. </returns>
+inline Card StandardRules::getStartingCard(int numPlayers)
+{
+	if (numPlayers == 5)
+	{
+		return Card(1, Card::Suit::CLUBS);
+	}
+	return Card(0, Card::Suit::CLUBS);
+}
+
+///<summary>
+///Gets the cards taken out of the deck so that it can be dealt evenly.
+///3 players - 2 of Diamonds is removed
+///4 players - No cards are removed
+///5 players - 2 of Diamonds and 2 of Clubs are removed
+///</summary>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<returns> The cards removed from the deck. </returns>
+inline BitHand StandardRules::getRemovedCards(int numPlayers)
+{
+	BitHand removedCards;
+	if (numPlayers == 3 || numPlayers == 5)
+	{
+		removedCards.addCard(Card(0, Card::Suit::DIAMONDS));
+	}
+	if (numPlayers == 5)
+	{
+		removedCards.addCard(Card(0, Card::Suit::CLUBS));
+	}
+	return removedCards;
+}
+
+#endif // !HEARTSRULES_H
@@ -0,0 +1,444 @@
+#ifndef HEARTSSERVER_H
+#define HEARTSSERVER_H
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <algorithm> // for std::max()
+#include "HeartsGame.h"
+#include "PlayerPolicy.h"
+#include "ClientSeatPolicy.h"
+
+///<summary> Totals kept by a HeartsServer while it runs. </summary>
+struct ServerStats
+{
+	int tablesFinished;
+	long long roundsPlayed;
+	long long slicesRun;				// Times a worker picked up a table
+	long long repliesReceived;
+	long long rejectedReplies;
+	long long resumes;					// Times a table waiting on a client was picked up again after its reply
+	long long totalResumeNanoseconds;	// From a reply arriving to its table running again
+	long long maxResumeNanoseconds;
+	long long maxSliceNanoseconds;		// Longest a worker spent on one table before moving on
+};
+
+///<summary>
+///A single game hosted by a HeartsServer, with the seats and scheduling state that go with it.
+///status and the wake fields are shared with client threads and guarded by mutex. The game is only touched by the worker running it.
+///</summary>
+struct ServerTable
+{
+	enum class Status { QUEUED, RUNNING, WAITING, FINISHED };
+
+	HeartsGame game;
+	std::vector<PlayerPolicy*> policies;
+	std::vector<ClientSeatPolicy*> clientSeats;	// nullptr for bot seats
+	std::mutex mutex;
+	Status status;
+	bool isWakePending;							// A reply arrived while the table was running
+	bool isWoken;								// The table is queued because of a reply that arrived at wakeTime
+	std::chrono::steady_clock::time_point wakeTime;
+
+	ServerTable(int numPlayers);
+};
+
+///<summary>
+///Hosts many games of Hearts in one process. Each seat is played by a bot (any PlayerPolicy) or by a client that talks to
+///the server through SeatRequest and SeatReply messages.
+///Tables are not given a thread each. A fixed pool of workers takes tables off a shared ready queue, plays at most
+///TRICKS_PER_SLICE tricks, then puts the table at the back of the queue. A table waiting on a client leaves the queue until
+///submit() delivers the reply, so waiting tables cost no worker time and no table can hold a worker for more than one slice.
+///That keeps the delay between a reply arriving and its table moving again bounded by the queue length, not by the slowest game.
+///</summary>
+class HeartsServer
+{
+public:
+	static const int TRICKS_PER_SLICE = 4;
+
+	HeartsServer(int numPlayers);
+	~HeartsServer();
+	void setNumThreads(int numThreads);
+	void setTargetScore(int targetScore);
+	int addTable(unsigned int seed);
+	void setBotSeat(int tableId, int seat, PlayerPolicy *policy);
+	void setClientSeat(int tableId, int seat, std::function<void(const SeatRequest&)> send);
+	int getNumTables();
+	void start();
+	void submit(const SeatReply &reply);
+	void waitUntilFinished();
+	void stop();
+	ServerStats getStats();
+
+private:
+	int m_numPlayers;
+	int m_numThreads;
+	int m_targetScore;
+	std::vector<ServerTable*> m_tables;
+	std::vector<ServerStats> m_workerStats;		// One per worker so workers never share a counter
+	std::vector<std::thread> m_workers;
+	std::atomic<long long> m_repliesReceived;
+	// The event loop's ready queue, and what wakes the workers and waitUntilFinished()
+	std::mutex m_queueMutex;
+	std::condition_variable m_queueCondition;
+	std::condition_variable m_finishedCondition;
+	std::deque<int> m_readyTables;
+	int m_openTables;
+	bool m_isStopping;
+
+	void runWorker(int worker);
+	void runSlice(int tableId, ServerStats &stats);
+	void schedule(int tableId);
+	void finishTable(ServerTable &table, ServerStats &stats);
+	bool isGameOver(ServerTable &table);
+};
+
+///<summary> Constructor for a ServerTable. Every seat starts empty. </summary>
+///<param name="numPlayers"> Number of players at the table. </param>
+///<returns> Nothing. </returns>
+inline ServerTable::ServerTable(int numPlayers) : game(numPlayers)
+{
+	policies.resize(numPlayers, nullptr);
+	clientSeats.resize(numPlayers, nullptr);
+	status = Status::QUEUED;
+	isWakePending = false;
+	isWoken = false;
+}
+
+///<summary> Constructor for a HeartsServer with no tables. Uses one worker per hardware thread. </summary>
+///<param name="numPlayers"> Number of players at every table. </param>
+///<returns> Nothing. </returns>
+HeartsServer::HeartsServer(int numPlayers) : m_repliesReceived(0)
+{
+	m_numPlayers = numPlayers;
+	m_numThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+	m_targetScore = 100;
+	m_openTables = 0;
+	m_isStopping = false;
+}
+
+///<summary> Destructor for HeartsServer. Stops the workers and deletes every table and the policies in its seats. </summary>
+///<returns> Nothing. </returns>
+HeartsServer::~HeartsServer()
+{
+	HeartsServer::stop();
+	for (ServerTable *table : m_tables)
+	{
+		for (PlayerPolicy *policy : table->policies)
+		{
+			delete policy;
+		}
+		delete table;
+	}
+}
+
+///<summary> Setter for the number of workers. Only takes effect when start() is next called. </summary>
+///<param name="numThreads"> Number of worker threads. </param>
+///<returns> Nothing. </returns>
+inline void HeartsServer::setNumThreads(int numThreads)
+{
+	m_numThreads = std::max(1, numThreads);
+}
+
+///<summary> Setter for the score that ends a game. </summary>
+///<param name="targetScore"> A table's game ends after the round where any player reaches this score. </param>
+///<returns> Nothing. </returns>
+inline void HeartsServer::setTargetScore(int targetScore)
+{
+	m_targetScore = targetScore;
+}
+
+///<summary> Opens a new table. Every seat has to be given a bot or a client before start() is called. </summary>
+///<param name="seed"> Seed for the table's deck. </param>
+///<returns> Id of the table, used to fill its seats and in every message for it. </returns>
+int HeartsServer::addTable(unsigned int seed)
+{
+	ServerTable *table = new ServerTable(m_numPlayers);
+	table->game.setHeadless(true);
+	table->game.setSeed(seed);
+	m_tables.push_back(table);
+	return m_tables.size() - 1;
+}
+
+///<summary> Gives a seat to a bot. </summary>
+///<param name="tableId"> Id of the table. </param>
+///<param name="seat"> Index of the seat at the table. </param>
+///<param name="policy"> The bot. The server takes ownership of it and deletes it with the table. </param>
+///<returns> Nothing. </returns>
+void HeartsServer::setBotSeat(int tableId, int seat, PlayerPolicy *policy)
+{
+	ServerTable &table = *m_tables.at(tableId);
+	delete table.policies.at(seat);
+	table.policies.at(seat) = policy;
+	table.clientSeats.at(seat) = nullptr;
+	table.game.setPlayerPolicy(seat, policy);
+}
+
+///<summary> Gives a seat to a client. The client answers the requests it is sent by calling submit(). </summary>
+///<param name="tableId"> Id of the table. </param>
+///<param name="seat"> Index of the seat at the table. </param>
+///<param name="send"> Delivers a request to the client. Called from worker threads, so it should only queue the message. </param>
+///<returns> Nothing. </returns>
+void HeartsServer::setClientSeat(int tableId, int seat, std::function<void(const SeatRequest&)> send)
+{
+	ClientSeatPolicy *clientSeat = new ClientSeatPolicy(tableId, seat, send);
+	HeartsServer::setBotSeat(tableId, seat, clientSeat);
+	m_tables.at(tableId)->clientSeats.at(seat) = clientSeat;
+}
+
+///<summary> Getter for the number of tables. </summary>
+///<returns> Number of tables added. </returns>
+inline int HeartsServer::getNumTables()
+{
+	return m_tables.size();
+}
+
+///<summary> Queues every table and starts the workers. </summary>
+///<returns> Nothing. </returns>
+void HeartsServer::start()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_isStopping = false;
+		m_openTables = m_tables.size();
+		for (size_t t = 0; t < m_tables.size(); t++)
+		{
+			m_tables.at(t)->status = ServerTable::Status::QUEUED;
+			m_readyTables.push_back(t);
+		}
+	}
+	m_workerStats.assign(m_numThreads, ServerStats());
+	for (int w = 0; w < m_numThreads; w++)
+	{
+		m_workers.push_back(std::thread(&HeartsServer::runWorker, this, w));
+	}
+}
+
+///<summary>
+///Delivers a client's answer to its seat and wakes the table if it was waiting. Safe to call from any thread.
+///Replies for tables or seats that do not exist, or that belong to a bot, are ignored.
+///</summary>
+///<param name="reply"> The client's answer. </param>
+///<returns> Nothing. </returns>
+void HeartsServer::submit(const SeatReply &reply)
+{
+	m_repliesReceived++;
+	if (reply.tableId < 0 || reply.tableId >= static_cast<int>(m_tables.size()) || reply.seat < 0 || reply.seat >= m_numPlayers)
+	{
+		return;
+	}
+	ServerTable &table = *m_tables.at(reply.tableId);
+	ClientSeatPolicy *clientSeat = table.clientSeats.at(reply.seat);
+	if (clientSeat == nullptr)
+	{
+		return;
+	}
+	clientSeat->receive(reply);
+
+	std::unique_lock<std::mutex> lock(table.mutex);
+	if (table.status == ServerTable::Status::WAITING)
+	{
+		table.status = ServerTable::Status::QUEUED;
+		table.isWoken = true;
+		table.wakeTime = std::chrono::steady_clock::now();
+		lock.unlock();
+		HeartsServer::schedule(reply.tableId);
+	}
+	else if (table.status == ServerTable::Status::RUNNING)
+	{
+		// The worker running it requeues the table instead of leaving it waiting
+		table.isWakePending = true;
+		table.isWoken = true;
+		table.wakeTime = std::chrono::steady_clock::now();
+	}
+}
+
+///<summary> Blocks until the game at every table has ended. </summary>
+///<returns> Nothing. </returns>
+void HeartsServer::waitUntilFinished()
+{
+	std::unique_lock<std::mutex> lock(m_queueMutex);
+	m_finishedCondition.wait(lock, [this] { return m_openTables == 0; });
+}
+
+///<summary> Stops the workers once they finish the slice they are on. Tables still in play are left where they are. </summary>
+///<returns> Nothing. </returns>
+void HeartsServer::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_isStopping = true;
+		m_readyTables.clear();
+	}
+	m_queueCondition.notify_all();
+	for (std::thread &worker : m_workers)
+	{
+		worker.join();
+	}
+	m_workers.clear();
+}
+
+///<summary> Adds up the totals of every worker. Should be called once the workers have stopped. </summary>
+///<returns> The server's totals. </returns>
+ServerStats HeartsServer::getStats()
+{
+	ServerStats total = {};
+	for (ServerStats &stats : m_workerStats)
+	{
+		total.tablesFinished += stats.tablesFinished;
+		total.roundsPlayed += stats.roundsPlayed;
+		total.slicesRun += stats.slicesRun;
+		total.resumes += stats.resumes;
+		total.totalResumeNanoseconds += stats.totalResumeNanoseconds;
+		total.maxResumeNanoseconds = std::max(total.maxResumeNanoseconds, stats.maxResumeNanoseconds);
+		total.maxSliceNanoseconds = std::max(total.maxSliceNanoseconds, stats.maxSliceNanoseconds);
+	}
+	total.repliesReceived = m_repliesReceived;
+	for (ServerTable *table : m_tables)
+	{
+		for (ClientSeatPolicy *clientSeat : table->clientSeats)
+		{
+			if (clientSeat != nullptr)
+			{
+				total.rejectedReplies += clientSeat->getRejectedReplies();
+			}
+		}
+	}
+	return total;
+}
+
+///<summary> Event loop of one worker: takes the next ready table and runs a slice of it, until the server stops. </summary>
+///<param name="worker"> Index of the worker, used to find its totals. </param>
+///<returns> Nothing. </returns>
+void HeartsServer::runWorker(int worker)
+{
+	ServerStats &stats = m_workerStats.at(worker);
+	while (true)
+	{
+		int tableId;
+		{
+			std::unique_lock<std::mutex> lock(m_queueMutex);
+			m_queueCondition.wait(lock, [this] { return m_isStopping || !m_readyTables.empty(); });
+			if (m_isStopping)
+			{
+				return;
+			}
+			tableId = m_readyTables.front();
+			m_readyTables.pop_front();
+		}
+		HeartsServer::runSlice(tableId, stats);
+	}
+}
+
+///<summary>
+///Plays up to TRICKS_PER_SLICE tricks at a table, stopping early at the end of a round or when a client has to answer.
+///Afterwards the table goes to the back of the ready queue, waits for its client, or is finished if its game is over.
+///</summary>
+///<param name="tableId"> Id of the table. </param>
+///<param name="stats"> The worker's totals. </param>
+///<returns> Nothing. </returns>
+void HeartsServer::runSlice(int tableId, ServerStats &stats)
+{
+	ServerTable &table = *m_tables.at(tableId);
+	std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+	{
+		std::lock_guard<std::mutex> lock(table.mutex);
+		table.status = ServerTable::Status::RUNNING;
+		table.isWakePending = false;
+		if (table.isWoken)
+		{
+			long long resumeNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(startTime - table.wakeTime).count();
+			stats.resumes++;
+			stats.totalResumeNanoseconds += resumeNanoseconds;
+			stats.maxResumeNanoseconds = std::max(stats.maxResumeNanoseconds, resumeNanoseconds);
+			table.isWoken = false;
+		}
+	}
+
+	int roundsPlayed = table.game.getRoundsPlayed();
+	bool isReady = table.game.playUntilWaiting(TRICKS_PER_SLICE);
+	stats.slicesRun++;
+	long long sliceNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+	stats.maxSliceNanoseconds = std::max(stats.maxSliceNanoseconds, sliceNanoseconds);
+	if (table.game.getRoundsPlayed() != roundsPlayed)
+	{
+		stats.roundsPlayed++;
+		if (HeartsServer::isGameOver(table))
+		{
+			HeartsServer::finishTable(table, stats);
+			return;
+		}
+	}
+
+	std::unique_lock<std::mutex> lock(table.mutex);
+	if (isReady || table.isWakePending)
+	{
+		table.status = ServerTable::Status::QUEUED;
+		lock.unlock();
+		HeartsServer::schedule(tableId);
+	}
+	else
+	{
+		table.status = ServerTable::Status::WAITING;
+	}
+}
+
+///<summary> Puts a table at the back of the ready queue and wakes a worker for it. </summary>
+///<param name="tableId"> Id of the table. </param>
+///<returns> Nothing. </returns>
+void HeartsServer::schedule(int tableId)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_readyTables.push_back(tableId);
+	}
+	m_queueCondition.notify_one();
+}
+
+///<summary> Ends the game at a table, tells its clients their final scores, and wakes waitUntilFinished() after the last table. </summary>
+///<param name="table"> The table. </param>
+///<param name="stats"> The worker's totals. </param>
+///<returns> Nothing. </returns>
+void HeartsServer::finishTable(ServerTable &table, ServerStats &stats)
+{
+	{
+		std::lock_guard<std::mutex> lock(table.mutex);
+		table.status = ServerTable::Status::FINISHED;
+	}
+	for (int i = 0; i < m_numPlayers; i++)
+	{
+		if (table.clientSeats.at(i) != nullptr)
+		{
+			table.clientSeats.at(i)->sendGameOver(table.game.getPlayerPointsTotal(i));
+		}
+	}
+	stats.tablesFinished++;
+
+	std::lock_guard<std::mutex> lock(m_queueMutex);
+	m_openTables--;
+	if (m_openTables == 0)
+	{
+		m_finishedCondition.notify_all();
+	}
+}
+
+///<summary> Determines whether the game at a table has ended. Only meaningful between rounds. </summary>
+///<param name="table"> The table. </param>
+///<returns> True if any player has reached the target score, otherwise false. </returns>
+bool HeartsServer::isGameOver(ServerTable &table)
+{
+	for (int i = 0; i < m_numPlayers; i++)
+	{
+		if (table.game.getPlayerPointsTotal(i) >= m_targetScore)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+#endif // !HEARTSSERVER_H
@@ -0,0 +1,44 @@
+#ifndef HEARTSSTATE_H
+#define HEARTSSTATE_H
+#include <cstdint>
+#include <type_traits>
+#include "Card.h"
+
+///<summary>
+///Snapshot of everything in a HeartsGame that changes while it is played: hands, the trick in progress, the cards played
+///so far this round, every player's points, and the deck's card order and random generator state, so the rounds dealt
+///after a restore are the same ones the original game would have dealt. It holds no pointers and has a fixed size, so it is copied with a single
+///memcpy and can be written to and read from a file as raw bytes. Made by HeartsGame::getState() and restored with HeartsGame::setState().
+///Hands are BitHand bit sets and cards are BitHand positions (suit * 13 + number).
+///</summary>
+struct HeartsState
+{
+	static const int MAX_PLAYERS = 5;
+	static const int NO_LEADER = -1;
+
+	int numPlayers;
+	uint64_t hands[MAX_PLAYERS];
+	int pointsTotal[MAX_PLAYERS];
+	int pointsThisRound[MAX_PLAYERS];
+	int pointsThisTrick[MAX_PLAYERS];
+	int shootTheMoonCounts[MAX_PLAYERS];
+	int roundsPlayed;
+	bool isRoundInProgress;			// False between rounds, when the next thing to happen is a deal
+	bool isPassPending;				// Dealt, but the cards have not been passed yet
+	bool isFirstTrickOfRound;
+	bool canPlayHearts;
+	Card::Suit leadingCardSuit;
+	int trickLeader;				// Leader of the trick in progress, or of the next trick. NO_LEADER before the first trick
+	int trickSize;					// Cards played so far in the trick in progress
+	uint8_t trickCards[MAX_PLAYERS];
+	int numPlayedCards;				// Cards in finished tricks this round
+	uint8_t playedCards[52];
+	uint8_t playedCardPlayers[52];
+	int deckSize;					// Cards in the deck, in the order the next shuffle starts from
+	uint8_t deckCards[52];
+	uint64_t deckGeneratorState[4];
+};
+
+static_assert(std::is_trivially_copyable<HeartsState>::value, "HeartsState must stay trivially copyable so it can be copied and saved as raw bytes");
+
+#endif // !HEARTSSTATE_H
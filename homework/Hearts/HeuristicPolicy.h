@@ -0,0 +1,251 @@
+#ifndef HEURISTICPOLICY_H
+#define HEURISTICPOLICY_H
+#include <vector>
+#include <string>
+#include "Card.h"
+#include "PlayerPolicy.h"
+#include "BitHand.h"
+#include "HandFeatures.h"
+
+///<summary>
+///PlayerPolicy that follows a few common rules of thumb for Hearts:
+///Pass away the Queen of Spades and high spades, then empty a short suit if that makes a void, then high hearts and
+///high cards that have no low cards to protect them.
+///Duck under the winning card when following suit, and dump the Queen of Spades or high hearts when void in the leading suit.
+///</summary>
+class HeuristicPolicy : public PlayerPolicy
+{
+public:
+	HeuristicPolicy();
+	~HeuristicPolicy();
+	std::string getName();
+	std::vector<Card> chooseCardsToPass(const std::vector<Card> &hand, int playerIndex, int numPlayers, int passOffset, int numCards);
+	Card chooseCardToPlay(const PlayView &view);
+
+private:
+	static const int NO_SUIT = -1;
+
+	static Card mostDangerousCard(const HandFeatures &features);
+	static int suitToVoid(const HandFeatures &features, int numPasses);
+	static bool isQueenOfSpades(const Card &card);
+	static int trickPoints(const std::vector<Card> &trickCards);
+};
+
+///<summary> Constructor for HeuristicPolicy object. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+HeuristicPolicy::HeuristicPolicy()
+{
+}
+
+///<summary> Default destructor for HeuristicPolicy class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+HeuristicPolicy::~HeuristicPolicy()
+{
+}
+
+///<summary> Getter for the name of the policy. </summary>
+///<returns> The name of the policy. </returns>
+inline std::string HeuristicPolicy::getName()
+{
+	return "Heuristic";
+}
+
+///<summary>
+///Selects the cards to pass. High spades go first, since they are the most dangerous cards to keep. After that, if
+///the hand has no void yet and a short Club or Diamond suit can be passed away completely, it is, so the player can
+///start dumping points the first time that suit is led. The rest are the most dangerous cards left.
+///</summary>
+///<param name="hand"> The player's current hand. </param>
+///<param name="playerIndex"> Index of the player passing cards. </param>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<param name="passOffset"> The cards go to the player this many seats after this one. </param>
+///<param name="numCards"> Number of cards to select. </param>
+///<returns> A vector of distinct cards from the hand. </returns>
+std::vector<Card> HeuristicPolicy::chooseCardsToPass(const std::vector<Card> &hand, int /*playerIndex*/, int /*numPlayers*/, int /*passOffset*/, int numCards)
+{
+	BitHand remaining(hand);
+	std::vector<Card> passedCards;
+	for (int i = 0; i < numCards; i++)
+	{
+		HandFeatures features(remaining);
+		Card card = mostDangerousCard(features);
+		int voidSuit = suitToVoid(features, numCards - i);
+		if (!(card.getSuit() == Card::Suit::SPADES && card.getNumber() >= 10) && voidSuit != NO_SUIT)
+		{
+			card = Card(features.highestNumber(static_cast<Card::Suit>(voidSuit)), static_cast<Card::Suit>(voidSuit));
+		}
+		passedCards.push_back(card);
+		remaining.removeCard(card);
+	}
+	return passedCards;
+}
+
+///<summary>
+///Chooses a card to play.
+///Leading - play the lowest card, preferring suits other than Hearts.
+///Following suit - play the highest card that still loses the trick, otherwise take it as cheaply as possible.
+///Void in the leading suit - dump the Queen of Spades, high spades, or high hearts.
+///</summary>
+///<param name="view"> The current state of the trick as seen by the player. </param>
+///<returns> The card to play. </returns>
+Card HeuristicPolicy::chooseCardToPlay(const PlayView &view)
+{
+	HandFeatures playable(BitHand(view.playableCards));
+	uint64_t heartsBits = BitHand::suitMask(Card::Suit::HEARTS);
+
+	if (view.trickCards.empty())
+	{
+		HandFeatures nonHearts(playable.getBits() & ~heartsBits);
+		return (nonHearts.getBits() != 0) ? nonHearts.lowestCard() : playable.lowestCard();
+	}
+
+	Card::Suit leadingSuit = view.trickCards.at(0).getSuit();
+	if (!playable.isVoid(leadingSuit))
+	{
+		// All playable cards are of the leading suit, since the player has to follow suit
+		int winningNumber = -1;
+		for (const Card &card : view.trickCards)
+		{
+			if (card.getSuit() == leadingSuit && card.getNumber() > winningNumber)
+			{
+				winningNumber = card.getNumber();
+			}
+		}
+		int duckNumber = playable.highestNumberBelow(leadingSuit, winningNumber);
+		if (duckNumber != HandFeatures::NO_CARD)
+		{
+			return Card(duckNumber, leadingSuit);
+		}
+
+		bool isLastToPlay = static_cast<int>(view.trickCards.size()) == view.numPlayers - 1;
+		if (isLastToPlay && trickPoints(view.trickCards) == 0)
+		{
+			// Going to win the trick anyway, so get rid of the highest card that does not give ourselves points
+			HandFeatures safe(playable.getBits() & ~heartsBits & ~BitHand::cardBit(Card(10, Card::Suit::SPADES)));
+			if (safe.getBits() != 0)
+			{
+				return safe.highestCard();
+			}
+		}
+		return Card(playable.lowestNumber(leadingSuit), leadingSuit);
+	}
+
+	return mostDangerousCard(playable);
+}
+
+///<summary>
+///Picks the card the player most wants to get rid of, either while passing or when void in the leading suit.
+///In order: the Ace, King, or Queen of Spades, the highest Heart, then the highest card of the suit whose high cards are
+///least protected by safe low cards, and if there are no high cards left, the highest card.
+///</summary>
+///<param name="features"> Features of the cards to choose from. Must not be empty. </param>
+///<returns> The card to get rid of. </returns>
+Card HeuristicPolicy::mostDangerousCard(const HandFeatures &features)
+{
+	int spadeNumber = features.highestNumber(Card::Suit::SPADES);
+	if (spadeNumber >= 10)
+	{
+		return Card(spadeNumber, Card::Suit::SPADES);
+	}
+	int heartNumber = features.highestNumber(Card::Suit::HEARTS);
+	if (heartNumber != HandFeatures::NO_CARD)
+	{
+		return Card(heartNumber, Card::Suit::HEARTS);
+	}
+	// A high card with few safe low cards beside it will probably have to win a trick, so the least protected goes first
+	int leastProtectedSuit = NO_SUIT;
+	int fewestSafeLows = 0;
+	for (int suit = 0; suit < 4; suit++)
+	{
+		Card::Suit cardSuit = static_cast<Card::Suit>(suit);
+		if (features.highCardCount(cardSuit) > 0 && (leastProtectedSuit == NO_SUIT || features.safeLowCount(cardSuit) < fewestSafeLows))
+		{
+			leastProtectedSuit = suit;
+			fewestSafeLows = features.safeLowCount(cardSuit);
+		}
+	}
+	if (leastProtectedSuit != NO_SUIT)
+	{
+		return Card(features.highestNumber(static_cast<Card::Suit>(leastProtectedSuit)), static_cast<Card::Suit>(leastProtectedSuit));
+	}
+	// No high cards left. Between suits with the same highest number the lowest suit goes first
+	Card::Suit bestSuit = Card::Suit::CLUBS;
+	int bestNumber = HandFeatures::NO_CARD;
+	for (int suit = 0; suit < 4; suit++)
+	{
+		int number = features.highestNumber(static_cast<Card::Suit>(suit));
+		if (number > bestNumber)
+		{
+			bestSuit = static_cast<Card::Suit>(suit);
+			bestNumber = number;
+		}
+	}
+	return Card(bestNumber, bestSuit);
+}
+
+///<summary>
+///Finds a short Club or Diamond suit that can be passed away completely. A hand that already has a void does not need
+///another one before the first trick, so the passes are left for dangerous cards.
+///</summary>
+///<param name="features"> Features of the cards left to pass from. </param>
+///<param name="numPasses"> Number of cards still to pass. </param>
+///<returns> The suit to empty, the one with the most high cards and then the fewest cards, or NO_SUIT if there is none. </returns>
+int HeuristicPolicy::suitToVoid(const HandFeatures &features, int numPasses)
+{
+	if (features.getVoidCount() > 0)
+	{
+		return NO_SUIT;
+	}
+	int bestSuit = NO_SUIT;
+	for (Card::Suit suit : { Card::Suit::CLUBS, Card::Suit::DIAMONDS })
+	{
+		int count = features.countOfSuit(suit);
+		if (count > numPasses)
+		{
+			continue;
+		}
+		if (bestSuit == NO_SUIT)
+		{
+			bestSuit = static_cast<int>(suit);
+			continue;
+		}
+		Card::Suit best = static_cast<Card::Suit>(bestSuit);
+		int highCards = features.highCardCount(suit);
+		int bestHighCards = features.highCardCount(best);
+		if (highCards > bestHighCards || (highCards == bestHighCards && count < features.countOfSuit(best)))
+		{
+			bestSuit = static_cast<int>(suit);
+		}
+	}
+	return bestSuit;
+}
+
+///<summary> Determines whether the given card is the Queen of Spades. </summary>
+///<param name="card"> Card to check. </param>
+///<returns> True if the card is the Queen of Spades, otherwise false. </returns>
+inline bool HeuristicPolicy::isQueenOfSpades(const Card &card)
+{
+	return card.getNumber() == 10 && card.getSuit() == Card::Suit::SPADES;
+}
+
+///<summary> Counts the points in the cards played so far this trick. </summary>
+///<param name="trickCards"> Cards played so far this trick. </param>
+///<returns> Number of points in the trick. </returns>
+int HeuristicPolicy::trickPoints(const std::vector<Card> &trickCards)
+{
+	int points = 0;
+	for (const Card &card : trickCards)
+	{
+		if (card.getSuit() == Card::Suit::HEARTS)
+		{
+			points++;
+		}
+		else if (isQueenOfSpades(card))
+		{
+			points = points + 13;
+		}
+	}
+	return points;
+}
+
+#endif // !HEURISTICPOLICY_H
@@ -0,0 +1,217 @@
+#ifndef LOOPBACKCLIENT_H
+#define LOOPBACKCLIENT_H
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <algorithm> // for std::max()
+#include "Card.h"
+#include "BitHand.h"
+#include "HandFeatures.h"
+#include "ClientSeatPolicy.h"
+#include "HeartsServer.h"
+
+///<summary>
+///In-process stand-in for the clients connected to a HeartsServer, for testing the server without a network.
+///Requests are queued instead of sent over a connection, and a few threads answer them the way a simple client would:
+///pass the highest cards and play the lowest legal card. Answers go back through HeartsServer::submit() like a real client's.
+///One LoopbackClient can play any number of seats. It can also follow every answer with a stray second reply holding no
+///cards, like a duplicate or hostile message from a real client, to check the server drops it.
+///</summary>
+class LoopbackClient
+{
+public:
+	LoopbackClient(HeartsServer *server);
+	~LoopbackClient();
+	void setNumThreads(int numThreads);
+	void setSendsStrayReplies(bool sendsStrayReplies);
+	std::function<void(const SeatRequest&)> getSender();
+	void send(const SeatRequest &request);
+	void start();
+	void stop();
+	long long getRequestsAnswered();
+	int getGamesFinished();
+	long long getStrayRepliesSent();
+
+private:
+	HeartsServer *m_server;
+	int m_numThreads;
+	std::vector<std::thread> m_threads;
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::deque<SeatRequest> m_requests;
+	bool m_isStopping;
+	bool m_sendsStrayReplies;
+	std::atomic<long long> m_requestsAnswered;
+	std::atomic<int> m_gamesFinished;
+	std::atomic<long long> m_strayRepliesSent;
+
+	void runClient();
+	static SeatReply answer(const SeatRequest &request);
+};
+
+///<summary> Constructor for a LoopbackClient with one answering thread. </summary>
+///<param name="server"> The server to send answers to. </param>
+///<returns> Nothing. </returns>
+LoopbackClient::LoopbackClient(HeartsServer *server) : m_requestsAnswered(0), m_gamesFinished(0), m_strayRepliesSent(0)
+{
+	m_server = server;
+	m_numThreads = 1;
+	m_isStopping = false;
+	m_sendsStrayReplies = false;
+}
+
+///<summary> Destructor for LoopbackClient. Stops the answering threads. </summary>
+///<returns> Nothing. </returns>
+LoopbackClient::~LoopbackClient()
+{
+	LoopbackClient::stop();
+}
+
+///<summary> Setter for the number of answering threads. Only takes effect when start() is next called. </summary>
+///<param name="numThreads"> Number of threads. </param>
+///<returns> Nothing. </returns>
+inline void LoopbackClient::setNumThreads(int numThreads)
+{
+	m_numThreads = std::max(1, numThreads);
+}
+
+///<summary> Setter for whether every answer is followed by a second reply with no cards. Only takes effect when start() is next called. </summary>
+///<param name="sendsStrayReplies"> True to send the stray replies. </param>
+///<returns> Nothing. </returns>
+inline void LoopbackClient::setSendsStrayReplies(bool sendsStrayReplies)
+{
+	m_sendsStrayReplies = sendsStrayReplies;
+}
+
+///<summary> Gets the function to give HeartsServer::setClientSeat() for a seat this client plays. </summary>
+///<returns> A function that queues a request for this client. </returns>
+inline std::function<void(const SeatRequest&)> LoopbackClient::getSender()
+{
+	return [this](const SeatRequest &request) { send(request); };
+}
+
+///<summary> Queues a request from the server. Stands in for the request arriving over a connection. </summary>
+///<param name="request"> The request. </param>
+///<returns> Nothing. </returns>
+void LoopbackClient::send(const SeatRequest &request)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_requests.push_back(request);
+	}
+	m_condition.notify_one();
+}
+
+///<summary> Starts the answering threads. </summary>
+///<returns> Nothing. </returns>
+void LoopbackClient::start()
+{
+	m_isStopping = false;
+	for (int t = 0; t < m_numThreads; t++)
+	{
+		m_threads.push_back(std::thread(&LoopbackClient::runClient, this));
+	}
+}
+
+///<summary> Stops the answering threads once every request already queued has been answered. </summary>
+///<returns> Nothing. </returns>
+void LoopbackClient::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_isStopping = true;
+	}
+	m_condition.notify_all();
+	for (std::thread &thread : m_threads)
+	{
+		thread.join();
+	}
+	m_threads.clear();
+}
+
+///<summary> Getter for the number of pass and play requests answered. </summary>
+///<returns> Number of requests answered. </returns>
+inline long long LoopbackClient::getRequestsAnswered()
+{
+	return m_requestsAnswered;
+}
+
+///<summary> Getter for the number of GAME_OVER messages received, one for each seat this client played. </summary>
+///<returns> Number of games finished. </returns>
+inline int LoopbackClient::getGamesFinished()
+{
+	return m_gamesFinished;
+}
+
+///<summary> Getter for the number of stray second replies sent. </summary>
+///<returns> Number of stray replies. </returns>
+inline long long LoopbackClient::getStrayRepliesSent()
+{
+	return m_strayRepliesSent;
+}
+
+///<summary> Loop of one answering thread: takes the next request and sends the answer to the server, until stopped and out of requests. </summary>
+///<returns> Nothing. </returns>
+void LoopbackClient::runClient()
+{
+	while (true)
+	{
+		SeatRequest request;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_condition.wait(lock, [this] { return m_isStopping || !m_requests.empty(); });
+			if (m_requests.empty())
+			{
+				return;
+			}
+			request = m_requests.front();
+			m_requests.pop_front();
+		}
+		if (request.type == SeatRequest::Type::GAME_OVER)
+		{
+			m_gamesFinished++;
+			continue;
+		}
+		SeatReply reply = LoopbackClient::answer(request);
+		m_server->submit(reply);
+		m_requestsAnswered++;
+		if (m_sendsStrayReplies)
+		{
+			// Arrives after the real answer, so the seat has to drop it or it would play a card that is not there
+			reply.cards = 0;
+			m_server->submit(reply);
+			m_strayRepliesSent++;
+		}
+	}
+}
+
+///<summary> Chooses the answer to a request. Passes the highest cards in the hand, or plays the lowest legal card. </summary>
+///<param name="request"> A PASS_CARDS or PLAY_CARD request. </param>
+///<returns> The answer. </returns>
+SeatReply LoopbackClient::answer(const SeatRequest &request)
+{
+	SeatReply reply = {};
+	reply.tableId = request.tableId;
+	reply.seat = request.seat;
+	if (request.type == SeatRequest::Type::PASS_CARDS)
+	{
+		BitHand remaining(request.hand);
+		for (int i = 0; i < request.numCards; i++)
+		{
+			Card card = HandFeatures(remaining).highestCard();
+			reply.cards |= BitHand::cardBit(card);
+			remaining.removeCard(card);
+		}
+	}
+	else
+	{
+		reply.cards = BitHand::cardBit(HandFeatures(BitHand(request.playableCards)).lowestCard());
+	}
+	return reply;
+}
+
+#endif // !LOOPBACKCLIENT_H
@@ -0,0 +1,70 @@
+#ifndef LOWESTCARDPOLICY_H
+#define LOWESTCARDPOLICY_H
+#include <vector>
+#include <string>
+#include "Card.h"
+#include "PlayerPolicy.h"
+#include "BitHand.h"
+#include "HandFeatures.h"
+
+///<summary>
+///PlayerPolicy that always plays its lowest valued legal card and passes away its highest valued cards.
+///</summary>
+class LowestCardPolicy : public PlayerPolicy
+{
+public:
+	LowestCardPolicy();
+	~LowestCardPolicy();
+	std::string getName();
+	std::vector<Card> chooseCardsToPass(const std::vector<Card> &hand, int playerIndex, int numPlayers, int passOffset, int numCards);
+	Card chooseCardToPlay(const PlayView &view);
+};
+
+///<summary> Constructor for LowestCardPolicy object. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+LowestCardPolicy::LowestCardPolicy()
+{
+}
+
+///<summary> Default destructor for LowestCardPolicy class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+LowestCardPolicy::~LowestCardPolicy()
+{
+}
+
+///<summary> Getter for the name of the policy. </summary>
+///<returns> The name of the policy. </returns>
+inline std::string LowestCardPolicy::getName()
+{
+	return "Lowest Card";
+}
+
+///<summary> Selects the highest valued cards in the hand to pass, regardless of suit. </summary>
+///<param name="hand"> The player's current hand. </param>
+///<param name="playerIndex"> Index of the player passing cards. </param>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<param name="passOffset"> The cards go to the player this many seats after this one. </param>
+///<param name="numCards"> Number of cards to select. </param>
+///<returns> A vector of distinct cards from the hand. </returns>
+std::vector<Card> LowestCardPolicy::chooseCardsToPass(const std::vector<Card> &hand, int /*playerIndex*/, int /*numPlayers*/, int /*passOffset*/, int numCards)
+{
+	BitHand remaining(hand);
+	std::vector<Card> passedCards;
+	for (int i = 0; i < numCards; i++)
+	{
+		Card card = HandFeatures(remaining).highestCard();
+		passedCards.push_back(card);
+		remaining.removeCard(card);
+	}
+	return passedCards;
+}
+
+///<summary> Plays the lowest valued card out of the playable cards, regardless of suit. </summary>
+///<param name="view"> The current state of the trick as seen by the player. </param>
+///<returns> The card to play. </returns>
+Card LowestCardPolicy::chooseCardToPlay(const PlayView &view)
+{
+	return HandFeatures(BitHand(view.playableCards)).lowestCard();
+}
+
+#endif // !LOWESTCARDPOLICY_H
@@ -0,0 +1,648 @@
+#ifndef MONTECARLOPOLICY_H
+#define MONTECARLOPOLICY_H
+#include <vector>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <functional>
+#include <algorithm> // for std::iter_swap() and std::max()
+#include <cstdint>
+#include "Card.h"
+#include "BitHand.h"
+#include "TrickState.h"
+#include "PlayerPolicy.h"
+#include "HeartsGame.h"
+#include "TrickScorer.h"
+#include "HandFeatures.h"
+#include "RandomGenerator.h"
+
+///<summary>
+///PlayerPolicy that searches using determinized Monte Carlo rollouts.
+///For each decision it deals the cards it cannot see to the other players in a way that agrees with everything it knows
+///(cards already played, suits other players have shown they are out of, cards it passed), then plays the rest of the round
+///out with a fast rule of thumb player for every candidate card. The candidate with the fewest expected points is chosen.
+///Rollouts are split across threads, and each decision stops at whichever comes first: the rollout budget or the time limit.
+///</summary>
+class MonteCarloPolicy : public PlayerPolicy
+{
+public:
+	MonteCarloPolicy();
+	MonteCarloPolicy(int numRollouts, int timeLimit, int numThreads, unsigned int seed);
+	~MonteCarloPolicy();
+	std::string getName();
+	std::vector<Card> chooseCardsToPass(const std::vector<Card> &hand, int playerIndex, int numPlayers, int passOffset, int numCards);
+	Card chooseCardToPlay(const PlayView &view);
+	void setNumRollouts(int numRollouts);
+	void setTimeLimit(int timeLimit);
+	void setNumThreads(int numThreads);
+
+private:
+	static const int MAX_PLAYERS = 5;
+	static const int PASS_CANDIDATES = 6;
+	static const int DEAL_ATTEMPTS = 50;
+	static const uint64_t QUEEN_OF_SPADES_BIT = uint64_t(1) << (3 * 13 + 10);
+	static const uint64_t HIGH_SPADES_BITS = uint64_t(3) << (3 * 13 + 11); // King and Ace of Spades
+	static const uint64_t HEARTS_BITS = BitHand::SUIT_BITS << (2 * 13);
+	static const uint64_t CLUBS_BITS = BitHand::SUIT_BITS;
+
+	///<summary> Compact copy of a round used for rollouts. Cards are BitHand bit positions. </summary>
+	struct RolloutState
+	{
+		int numPlayers;
+		uint64_t hands[MAX_PLAYERS];
+		int points[MAX_PLAYERS];
+		uint8_t trickCards[MAX_PLAYERS];
+		int trickSize;
+		int leader;
+		TrickState trickState;
+	};
+
+	int m_numRollouts;
+	int m_timeLimit;
+	int m_numThreads;
+	RandomGenerator m_generator;
+	std::vector<uint64_t> m_passedCards;
+
+	std::vector<double> evaluateCandidates(int numCandidates, const std::function<void(RandomGenerator &, std::vector<double> &)> &sampleAndScore);
+	static bool dealUnseenCards(RandomGenerator &generator, RolloutState &state, uint64_t unseen, const int capacities[], const int voids[], uint64_t forcedCards, int forcedPlayer);
+	static void playCard(RolloutState &state, int cardIndex);
+	static int chooseRolloutCard(RolloutState &state);
+	static int finishRollout(RolloutState &state, int playerIndex);
+	static uint64_t choosePassBits(uint64_t hand, int numCards);
+	static int passPriority(int cardIndex);
+};
+
+///<summary> Constructor for MonteCarloPolicy object. Uses 2000 rollouts, a quarter second limit, and every hardware thread. </summary>
+///<returns> Nothing. </returns>
+MonteCarloPolicy::MonteCarloPolicy()
+{
+	m_numRollouts = 2000;
+	m_timeLimit = 250;
+	m_numThreads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+///<summary> Constructor for MonteCarloPolicy object. </summary>
+///<param name="numRollouts"> Most deals to sample for each decision. </param>
+///<param name="timeLimit"> Most milliseconds to spend on each decision. At least one deal is always sampled. </param>
+///<param name="numThreads"> Number of threads to run rollouts on. </param>
+///<param name="seed"> Seed for the random number generator. </param>
+///<returns> Nothing. </returns>
+MonteCarloPolicy::MonteCarloPolicy(int numRollouts, int timeLimit, int numThreads, unsigned int seed) : m_generator(seed)
+{
+	m_numRollouts = numRollouts;
+	m_timeLimit = timeLimit;
+	m_numThreads = std::max(1, numThreads);
+}
+
+///<summary> Default destructor for MonteCarloPolicy class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+MonteCarloPolicy::~MonteCarloPolicy()
+{
+}
+
+///<summary> Getter for the name of the policy. </summary>
+///<returns> The name of the policy. </returns>
+inline std::string MonteCarloPolicy::getName()
+{
+	return "Monte Carlo";
+}
+
+///<summary> Setter for the most deals sampled for each decision. </summary>
+///<param name="numRollouts"> Number of deals. </param>
+///<returns> Nothing. </returns>
+inline void MonteCarloPolicy::setNumRollouts(int numRollouts)
+{
+	m_numRollouts = numRollouts;
+}
+
+///<summary> Setter for the most time spent on each decision. </summary>
+///<param name="timeLimit"> Time limit in milliseconds. </param>
+///<returns> Nothing. </returns>
+inline void MonteCarloPolicy::setTimeLimit(int timeLimit)
+{
+	m_timeLimit = timeLimit;
+}
+
+///<summary> Setter for the number of threads rollouts are split across. </summary>
+///<param name="numThreads"> Number of threads. </param>
+///<returns> Nothing. </returns>
+inline void MonteCarloPolicy::setNumThreads(int numThreads)
+{
+	m_numThreads = std::max(1, numThreads);
+}
+
+///<summary>
+///Chooses cards to pass to another player.
+///The most dangerous cards in the hand are shortlisted and every combination of them is tried against random deals of the other hands.
+///Opponents pass by rule of thumb, then the whole round is rolled out.
+///</summary>
+///<param name="hand"> The player's current hand. </param>
+///<param name="playerIndex"> Index of the player passing cards. </param>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<param name="passOffset"> The cards go to the player this many seats after this one. </param>
+///<param name="numCards"> Number of cards to select. </param>
+///<returns> A vector of distinct cards from the hand. </returns>
+std::vector<Card> MonteCarloPolicy::chooseCardsToPass(const std::vector<Card> &hand, int playerIndex, int numPlayers, int passOffset, int numCards)
+{
+	uint64_t handBits = BitHand(hand).getBits();
+	uint64_t deckBits = ((uint64_t(1) << 52) - 1) & ~HeartsGame::getRemovedCards(numPlayers).getBits();
+	int handSize = hand.size();
+	Card startingCard = HeartsGame::getStartingCard(numPlayers);
+
+	// Shortlist the most dangerous cards then try every way of picking numCards of them
+	std::vector<int> shortlist;
+	uint64_t remaining = handBits;
+	int shortlistSize = (handSize < PASS_CANDIDATES) ? handSize : PASS_CANDIDATES;
+	for (int i = 0; i < shortlistSize; i++)
+	{
+		int bestIndex = -1;
+		for (uint64_t bits = remaining; bits != 0; bits &= bits - 1)
+		{
+			int index = BitHand::lowestBitIndex(bits);
+			if (bestIndex == -1 || passPriority(index) > passPriority(bestIndex))
+			{
+				bestIndex = index;
+			}
+		}
+		shortlist.push_back(bestIndex);
+		remaining &= ~(uint64_t(1) << bestIndex);
+	}
+	std::vector<uint64_t> candidates;
+	for (int combo = 0; combo < (1 << shortlistSize); combo++)
+	{
+		if (BitHand::countBits(combo) == numCards)
+		{
+			uint64_t passBits = 0;
+			for (int i = 0; i < shortlistSize; i++)
+			{
+				if (combo & (1 << i))
+				{
+					passBits |= uint64_t(1) << shortlist.at(i);
+				}
+			}
+			candidates.push_back(passBits);
+		}
+	}
+
+	auto sampleAndScore = [&](RandomGenerator &generator, std::vector<double> &totals)
+	{
+		RolloutState deal;
+		int capacities[MAX_PLAYERS] = {};
+		int voids[MAX_PLAYERS] = {};
+		uint64_t passes[MAX_PLAYERS];
+		deal.numPlayers = numPlayers;
+		for (int p = 0; p < numPlayers; p++)
+		{
+			capacities[p] = (p == playerIndex) ? 0 : handSize;
+			deal.hands[p] = 0;
+		}
+		deal.hands[playerIndex] = handBits;
+		dealUnseenCards(generator, deal, deckBits & ~handBits, capacities, voids, 0, -1);
+		for (int p = 0; p < numPlayers; p++)
+		{
+			passes[p] = choosePassBits(deal.hands[p], numCards);
+		}
+
+		for (size_t c = 0; c < candidates.size(); c++)
+		{
+			RolloutState state = deal;
+			passes[playerIndex] = candidates.at(c);
+			for (int p = 0; p < numPlayers; p++)
+			{
+				int fromPlayer = (p + numPlayers - passOffset) % numPlayers;
+				state.hands[p] = (deal.hands[p] & ~passes[p]) | passes[fromPlayer];
+				state.points[p] = 0;
+				if (state.hands[p] & BitHand::cardBit(startingCard))
+				{
+					state.leader = p;
+				}
+			}
+			state.trickSize = 0;
+			state.trickState.isFirstTrickOfRound = true;
+			state.trickState.isLeadingCard = true;
+			state.trickState.canPlayHearts = false;
+			state.trickState.canLeadQofS = true;
+			state.trickState.leadingCardSuit = Card::Suit::CLUBS;
+			state.trickState.startingCard = startingCard;
+			totals.at(c) += finishRollout(state, playerIndex);
+		}
+	};
+
+	std::vector<double> scores = evaluateCandidates(candidates.size(), sampleAndScore);
+	int best = std::min_element(scores.begin(), scores.end()) - scores.begin();
+
+	if (m_passedCards.size() < static_cast<size_t>(numPlayers))
+	{
+		m_passedCards.resize(numPlayers, 0);
+	}
+	m_passedCards.at(playerIndex) = candidates.at(best);
+	return BitHand(candidates.at(best)).toVector();
+}
+
+///<summary>
+///Chooses a card to play by trying every playable card against deals of the unseen cards that agree with what has been seen this round.
+///</summary>
+///<param name="view"> The current state of the trick as seen by the player. </param>
+///<returns> The card to play. </returns>
+Card MonteCarloPolicy::chooseCardToPlay(const PlayView &view)
+{
+	if (view.playableCards.size() == 1)
+	{
+		return view.playableCards.at(0);
+	}
+
+	int numPlayers = view.numPlayers;
+	int me = view.playerIndex;
+	int trickSize = view.trickCards.size();
+	uint64_t handBits = BitHand(view.hand).getBits();
+	uint64_t playedBits = BitHand(view.playedCards).getBits();
+	uint64_t trickBits = BitHand(view.trickCards).getBits();
+	uint64_t deckBits = ((uint64_t(1) << 52) - 1) & ~HeartsGame::getRemovedCards(numPlayers).getBits();
+	uint64_t unseen = deckBits & ~(handBits | playedBits | trickBits);
+	std::vector<int> candidates;
+	for (const Card &card : view.playableCards)
+	{
+		candidates.push_back(BitHand::cardIndex(card));
+	}
+
+	// Players that have already played this trick hold one card less than us
+	int capacities[MAX_PLAYERS] = {};
+	for (int p = 0; p < numPlayers; p++)
+	{
+		capacities[p] = (p == me) ? 0 : view.hand.size();
+	}
+	for (int i = 0; i < trickSize; i++)
+	{
+		capacities[view.playerOrder.at(i)]--;
+	}
+
+	// A player that did not follow the leading suit has shown they are out of it
+	int voids[MAX_PLAYERS] = {};
+	for (size_t trickStart = 0; trickStart < view.playedCards.size(); trickStart += numPlayers)
+	{
+		int leadingSuit = static_cast<int>(view.playedCards.at(trickStart).getSuit());
+		for (int i = 1; i < numPlayers; i++)
+		{
+			if (static_cast<int>(view.playedCards.at(trickStart + i).getSuit()) != leadingSuit)
+			{
+				voids[view.playedCardPlayers.at(trickStart + i)] |= 1 << leadingSuit;
+			}
+		}
+	}
+	for (int i = 1; i < trickSize; i++)
+	{
+		if (view.trickCards.at(i).getSuit() != view.trickCards.at(0).getSuit())
+		{
+			voids[view.playerOrder.at(i)] |= 1 << static_cast<int>(view.trickCards.at(0).getSuit());
+		}
+	}
+
+	// The cards we passed are still held by the player we passed them to, unless they have been played
+	uint64_t forcedCards = 0;
+	int passTarget = (me + view.passOffset) % numPlayers;
+	if (view.passOffset != 0 && static_cast<size_t>(me) < m_passedCards.size())
+	{
+		forcedCards = m_passedCards.at(me) & unseen;
+	}
+
+	RolloutState base;
+	base.numPlayers = numPlayers;
+	base.leader = view.playerOrder.at(0);
+	base.trickSize = trickSize;
+	base.trickState = view.trickState;
+	for (int p = 0; p < numPlayers; p++)
+	{
+		base.hands[p] = 0;
+		base.points[p] = view.pointsThisRound.at(p);
+	}
+	base.hands[me] = handBits;
+	for (int i = 0; i < trickSize; i++)
+	{
+		base.trickCards[i] = BitHand::cardIndex(view.trickCards.at(i));
+	}
+
+	auto sampleAndScore = [&](RandomGenerator &generator, std::vector<double> &totals)
+	{
+		RolloutState deal = base;
+		if (!dealUnseenCards(generator, deal, unseen, capacities, voids, forcedCards, passTarget))
+		{
+			// What we think we know cannot all be true, so fall back on a deal that only respects hand sizes
+			int noVoids[MAX_PLAYERS] = {};
+			deal = base;
+			dealUnseenCards(generator, deal, unseen, capacities, noVoids, 0, -1);
+		}
+		for (size_t c = 0; c < candidates.size(); c++)
+		{
+			RolloutState state = deal;
+			playCard(state, candidates.at(c));
+			totals.at(c) += finishRollout(state, me);
+		}
+	};
+
+	std::vector<double> scores = evaluateCandidates(candidates.size(), sampleAndScore);
+	int best = std::min_element(scores.begin(), scores.end()) - scores.begin();
+	return view.playableCards.at(best);
+}
+
+///<summary>
+///Runs sampleAndScore over and over across m_numThreads threads until m_numRollouts deals have been sampled or m_timeLimit runs out.
+///Each thread gets its own random number generator and its own totals, so the threads share nothing while they run.
+///</summary>
+///<param name="numCandidates"> Number of choices being compared. </param>
+///<param name="sampleAndScore"> Samples one deal and adds the points each candidate scored in it to the totals. </param>
+///<returns> The average points for each candidate. </returns>
+std::vector<double> MonteCarloPolicy::evaluateCandidates(int numCandidates, const std::function<void(RandomGenerator &, std::vector<double> &)> &sampleAndScore)
+{
+	int numThreads = m_numThreads;
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_timeLimit);
+	std::vector<std::vector<double>> threadTotals(numThreads, std::vector<double>(numCandidates, 0.0));
+	std::vector<int> threadSamples(numThreads, 0);
+	std::vector<uint64_t> seeds;
+	for (int t = 0; t < numThreads; t++)
+	{
+		seeds.push_back(m_generator.next());
+	}
+
+	auto worker = [&](int t)
+	{
+		RandomGenerator generator(seeds.at(t));
+		int share = m_numRollouts / numThreads + (t < m_numRollouts % numThreads ? 1 : 0);
+		for (int i = 0; i < share; i++)
+		{
+			// Always finish at least one deal so there is something to compare
+			if (i > 0 && std::chrono::steady_clock::now() >= deadline)
+			{
+				break;
+			}
+			sampleAndScore(generator, threadTotals.at(t));
+			threadSamples.at(t)++;
+		}
+	};
+
+	if (numThreads == 1)
+	{
+		worker(0);
+	}
+	else
+	{
+		std::vector<std::thread> threads;
+		for (int t = 0; t < numThreads; t++)
+		{
+			threads.push_back(std::thread(worker, t));
+		}
+		for (std::thread &thread : threads)
+		{
+			thread.join();
+		}
+	}
+
+	std::vector<double> averages(numCandidates, 0.0);
+	int totalSamples = 0;
+	for (int t = 0; t < numThreads; t++)
+	{
+		totalSamples += threadSamples.at(t);
+		for (int c = 0; c < numCandidates; c++)
+		{
+			averages.at(c) += threadTotals.at(t).at(c);
+		}
+	}
+	for (int c = 0; c < numCandidates; c++)
+	{
+		averages.at(c) = averages.at(c) / std::max(1, totalSamples);
+	}
+	return averages;
+}
+
+///<summary>
+///Deals the unseen cards to the other players at random.
+///Each player receives exactly their capacity in cards and never a card of a suit they are known to be out of.
+///</summary>
+///<param name="generator"> Random number generator to use. </param>
+///<param name="state"> State whose hands are filled in. Hands of players with a capacity of zero are left alone. </param>
+///<param name="unseen"> Cards to deal. </param>
+///<param name="capacities"> How many cards each player needs. </param>
+///<param name="voids"> For each player, a bit per suit they are known to be out of. </param>
+///<param name="forcedCards"> Cards that have to go to forcedPlayer. </param>
+///<param name="forcedPlayer"> Player receiving forcedCards, or -1 when there are none. </param>
+///<returns> True if a deal respecting every constraint was found, otherwise false. </returns>
+bool MonteCarloPolicy::dealUnseenCards(RandomGenerator &generator, RolloutState &state, uint64_t unseen, const int capacities[], const int voids[], uint64_t forcedCards, int forcedPlayer)
+{
+	std::vector<int> cards;
+	for (uint64_t bits = unseen & ~forcedCards; bits != 0; bits &= bits - 1)
+	{
+		cards.push_back(BitHand::lowestBitIndex(bits));
+	}
+	uint64_t originalHands[MAX_PLAYERS];
+	for (int p = 0; p < state.numPlayers; p++)
+	{
+		originalHands[p] = state.hands[p];
+	}
+
+	for (int attempt = 0; attempt < DEAL_ATTEMPTS; attempt++)
+	{
+		int remaining[MAX_PLAYERS];
+		int eligible[MAX_PLAYERS];
+		bool dealt = true;
+		for (int p = 0; p < state.numPlayers; p++)
+		{
+			remaining[p] = capacities[p];
+			state.hands[p] = originalHands[p];
+		}
+		if (forcedPlayer != -1)
+		{
+			state.hands[forcedPlayer] |= forcedCards;
+			remaining[forcedPlayer] -= BitHand::countBits(forcedCards);
+		}
+
+		for (int i = cards.size() - 1; i > 0; i--)
+		{
+			std::iter_swap(cards.begin() + i, cards.begin() + generator.nextBounded(i + 1));
+		}
+		for (size_t i = 0; i < cards.size() && dealt; i++)
+		{
+			int suit = cards.at(i) / BitHand::SUIT_SIZE;
+			int numEligible = 0;
+			for (int p = 0; p < state.numPlayers; p++)
+			{
+				if (remaining[p] > 0 && !(voids[p] & (1 << suit)))
+				{
+					eligible[numEligible++] = p;
+				}
+			}
+			if (numEligible == 0)
+			{
+				dealt = false;
+			}
+			else
+			{
+				int p = eligible[generator.nextBounded(numEligible)];
+				state.hands[p] |= uint64_t(1) << cards.at(i);
+				remaining[p]--;
+			}
+		}
+		if (dealt)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+///<summary>
+///Plays a card for whoever's turn it is in a rollout, scoring the trick once every player has played.
+///</summary>
+///<param name="state"> State of the rollout. </param>
+///<param name="cardIndex"> BitHand position of the card to play. </param>
+///<returns> Nothing. </returns>
+void MonteCarloPolicy::playCard(RolloutState &state, int cardIndex)
+{
+	int player = (state.leader + state.trickSize) % state.numPlayers;
+	int suit = cardIndex / BitHand::SUIT_SIZE;
+	state.hands[player] &= ~(uint64_t(1) << cardIndex);
+	if (state.trickSize == 0)
+	{
+		state.trickState.leadingCardSuit = static_cast<Card::Suit>(suit);
+	}
+	if (suit == static_cast<int>(Card::Suit::HEARTS))
+	{
+		state.trickState.canPlayHearts = true;
+	}
+	state.trickCards[state.trickSize++] = static_cast<uint8_t>(cardIndex);
+
+	if (state.trickSize == state.numPlayers)
+	{
+		int winningPos = TrickScorer::findWinningPosition(state.trickCards, state.numPlayers);
+		int winner = (state.leader + winningPos) % state.numPlayers;
+		state.points[winner] += TrickScorer::tallyPoints(state.trickCards, state.numPlayers);
+		state.leader = winner;
+		state.trickSize = 0;
+		state.trickState.isFirstTrickOfRound = false;
+	}
+}
+
+///<summary>
+///Rule of thumb player used inside rollouts. Works only on bits and lookup tables so it is cheap enough to run millions of times.
+///Leading - the lowest card, avoiding Hearts.
+///Following suit - the highest card that still loses, otherwise the lowest, or the highest when last to play.
+///Void - the Queen of Spades, then the King or Ace of Spades, then the highest Heart, then the highest card.
+///</summary>
+///<param name="state"> State of the rollout. Its TrickState is brought up to date for the player about to play. </param>
+///<returns> BitHand position of the card to play. </returns>
+int MonteCarloPolicy::chooseRolloutCard(RolloutState &state)
+{
+	int player = (state.leader + state.trickSize) % state.numPlayers;
+	uint64_t hand = state.hands[player];
+	state.trickState.isLeadingCard = (state.trickSize == 0);
+	if (state.trickSize == 0)
+	{
+		state.trickState.canLeadQofS = !(state.trickState.isFirstTrickOfRound && !(hand & CLUBS_BITS));
+	}
+	uint64_t legal = HeartsGame::legalMoves(BitHand(hand), state.trickState).getBits();
+
+	if (state.trickSize == 0)
+	{
+		uint64_t nonHearts = legal & ~HEARTS_BITS;
+		return BitHand::cardIndex(HandFeatures(nonHearts != 0 ? nonHearts : legal).lowestCard());
+	}
+
+	int leadingSuit = static_cast<int>(state.trickState.leadingCardSuit);
+	uint64_t leadingSuitBits = BitHand::SUIT_BITS << (leadingSuit * BitHand::SUIT_SIZE);
+	if (legal & leadingSuitBits)
+	{
+		int winningIndex = state.trickCards[TrickScorer::findWinningPosition(state.trickCards, state.trickSize)];
+		uint64_t below = legal & ((uint64_t(1) << winningIndex) - 1);
+		if (below != 0)
+		{
+			return BitHand::highestBitIndex(below);
+		}
+		if (state.trickSize == state.numPlayers - 1)
+		{
+			uint64_t safe = legal & ~QUEEN_OF_SPADES_BIT;
+			return BitHand::highestBitIndex(safe != 0 ? safe : legal);
+		}
+		return BitHand::lowestBitIndex(legal);
+	}
+
+	if (legal & QUEEN_OF_SPADES_BIT)
+	{
+		return BitHand::lowestBitIndex(QUEEN_OF_SPADES_BIT);
+	}
+	if (legal & HIGH_SPADES_BITS)
+	{
+		return BitHand::highestBitIndex(legal & HIGH_SPADES_BITS);
+	}
+	if (legal & HEARTS_BITS)
+	{
+		return BitHand::highestBitIndex(legal & HEARTS_BITS);
+	}
+	return BitHand::cardIndex(HandFeatures(legal).highestCard());
+}
+
+///<summary>
+///Plays a rollout to the end of the round and scores it for one player, including shooting the moon.
+///</summary>
+///<param name="state"> State of the rollout. </param>
+///<param name="playerIndex"> Player to score. </param>
+///<returns> The points the player ends the round with. </returns>
+int MonteCarloPolicy::finishRollout(RolloutState &state, int playerIndex)
+{
+	while (state.hands[(state.leader + state.trickSize) % state.numPlayers] != 0)
+	{
+		playCard(state, chooseRolloutCard(state));
+	}
+	for (int p = 0; p < state.numPlayers; p++)
+	{
+		if (state.points[p] == 26)
+		{
+			return (p == playerIndex) ? 0 : 26;
+		}
+	}
+	return state.points[playerIndex];
+}
+
+///<summary> Rule of thumb pass used for the other players inside rollouts. </summary>
+///<param name="hand"> The player's hand. </param>
+///<param name="numCards"> Number of cards to pass. </param>
+///<returns> The cards to pass. </returns>
+uint64_t MonteCarloPolicy::choosePassBits(uint64_t hand, int numCards)
+{
+	uint64_t passBits = 0;
+	for (int i = 0; i < numCards; i++)
+	{
+		int bestIndex = -1;
+		for (uint64_t bits = hand & ~passBits; bits != 0; bits &= bits - 1)
+		{
+			int index = BitHand::lowestBitIndex(bits);
+			if (bestIndex == -1 || passPriority(index) > passPriority(bestIndex))
+			{
+				bestIndex = index;
+			}
+		}
+		passBits |= uint64_t(1) << bestIndex;
+	}
+	return passBits;
+}
+
+///<summary> Ranks how much a player wants to get rid of a card. Same ranking as HeuristicPolicy, on bit positions. </summary>
+///<param name="cardIndex"> BitHand position of the card. </param>
+///<returns> A higher value for cards that should be gotten rid of first. </returns>
+int MonteCarloPolicy::passPriority(int cardIndex)
+{
+	int suit = cardIndex / BitHand::SUIT_SIZE;
+	int number = cardIndex % BitHand::SUIT_SIZE;
+	if (cardIndex == 3 * BitHand::SUIT_SIZE + 10)
+	{
+		return 100;
+	}
+	else if (suit == static_cast<int>(Card::Suit::SPADES) && number > 10)
+	{
+		return 90 + number;
+	}
+	else if (suit == static_cast<int>(Card::Suit::HEARTS))
+	{
+		return 50 + number;
+	}
+	return number;
+}
+
+#endif // !MONTECARLOPOLICY_H
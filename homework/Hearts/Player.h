@@ -3,6 +3,7 @@
 #include <vector>
 #include "Card.h"
 #include "Deck.h"
+#include "BitHand.h"
 
 ///<summary> 
 ///Player class used to represent a player in a game of Hearts.
@@ -13,17 +14,19 @@ public:
 	Player();
 	~Player();
 	// Round hand functions
-	std::vector<Card> getRoundHand();
-	void setRoundHand(std::vector<Card> &hand);
-	void addCardsToRoundHand(std::vector<Card> &cards);
-	void removeCardInRoundHand(Card &card);
-	void removeCardsInRoundHand(std::vector<Card> &cards);
+	const std::vector<Card> &getRoundHand() const;
+	BitHand getRoundHandBits() const;
+	void setRoundHand(const std::vector<Card> &hand);
+	void addCardsToRoundHand(const std::vector<Card> &cards);
+	void removeCardInRoundHand(const Card &card);
+	void removeCardsInRoundHand(const std::vector<Card> &cards);
 	void clearRoundHand();
 	// Points total functions
 	int getPointsTotal();
 	void addToPointsTotal(int val);
 	void addToAllPoints(int val);
 	void subtractFromPointsTotal(int val);
+	void setPoints(int pointsTotal, int pointsThisRound, int pointsThisTrick);
 	// Points this found functions
 	int getPointsThisRound();
 	void clearPointsThisRound();
@@ -34,6 +37,7 @@ public:
 
 private:
 	std::vector<Card> m_roundHand;
+	BitHand m_roundHandBits;
 	int m_pointsTotal;
 	int m_pointsThisRound;
 	int m_pointsThisTrick;
@@ -47,6 +51,7 @@ Player::Player()
 {
 	m_pointsTotal = 0;
 	m_pointsThisRound = 0;
+	m_pointsThisTrick = 0;
 }
 
 ///<summary> Default destructor for Player class. No special actions taken. </summary>
@@ -55,13 +60,20 @@ Player::~Player()
 {
 }
 
-///<summary> Getter function for round hand. </summary>
-///<returns> The hand of the player for a particular round, in the form of a vector of Cards. </returns>
-inline std::vector<Card> Player::getRoundHand()
+///<summary> Getter function for round hand. Returns a reference so looking at the hand never copies it. </summary>
+///<returns> The hand of the player for a particular round, in the form of a vector of Cards. Only valid until the hand next changes. </returns>
+inline const std::vector<Card> &Player::getRoundHand() const
 {
 	return m_roundHand;
 }
 
+///<summary> Getter function for the round hand as a bit set. Kept in sync with the vector version of the hand. </summary>
+///<returns> The hand of the player for a particular round, in the form of a BitHand. </returns>
+inline BitHand Player::getRoundHandBits() const
+{
+	return m_roundHandBits;
+}
+
 ///<summary> Getter function for player's total points. </summary>
 ///<returns> Player's total points. </returns>
 inline int Player::getPointsTotal()
@@ -69,43 +81,46 @@ inline int Player::getPointsTotal()
 	return m_pointsTotal;
 }
 
-///<summary> Setter function for round hand and sorts the hand. </summary>
+///<summary>
+///Setter function for round hand and sorts the hand.
+///The cards are put into the bit set first and read back out in order, which sorts them in one pass over the 52 possible cards.
+///</summary>
 ///<param name="hand"> Vector of cards representing hand. </param>
 ///<returns> Nothing. </returns>
-inline void Player::setRoundHand(std::vector<Card> &hand)
+inline void Player::setRoundHand(const std::vector<Card> &hand)
 {
-	m_roundHand = hand;
-	Deck::sort(m_roundHand);
+	m_roundHandBits = BitHand(hand);
+	m_roundHandBits.toVector(m_roundHand);
 }
 
 ///<summary> Appends a given vector of cards to the round hand and sorts the hand. </summary>
 ///<param name="cards"> Vector of cards to be appended. </param>
 ///<returns> Nothing. </returns>
-inline void Player::addCardsToRoundHand(std::vector<Card>& cards)
+inline void Player::addCardsToRoundHand(const std::vector<Card> &cards)
 {
-	for (int i = 0; i < cards.size(); i++)
-	{
-		m_roundHand.push_back(cards.at(i));
-	}
-	Deck::sort(m_roundHand);
+	// Rebuilding from the bit set keeps the hand sorted without a full sort, and reuses the vector's memory
+	m_roundHandBits.addCards(cards);
+	m_roundHandBits.toVector(m_roundHand);
 }
 
 ///<summary> Removes a single card from the round hand. </summary>
 ///<param name="card"> Card to be removed from round hand. </param>
 ///<returns> Nothing. </returns>
-inline void Player::removeCardInRoundHand(Card &card)
+inline void Player::removeCardInRoundHand(const Card &card)
 {
 	Deck::removeCard(m_roundHand, card);
+	m_roundHandBits.removeCard(card);
 }
 
 ///<summary> Removes a set of cards in a given vector from the round hand. </summary>
 ///<param name="cards"> Vector of cards to be removed. </param>
 ///<returns> Nothing. </returns>
-inline void Player::removeCardsInRoundHand(std::vector<Card>& cards)
+inline void Player::removeCardsInRoundHand(const std::vector<Card> &cards)
 {
 	for (int i = 0; i < cards.size(); i++)
 	{
 		Deck::removeCard(m_roundHand, cards.at(i));
+		m_roundHandBits.removeCard(cards.at(i));
 	}
 }
 
@@ -135,6 +150,18 @@ inline void Player::subtractFromPointsTotal(int val)
 	m_pointsTotal = m_pointsTotal - val;
 }
 
+///<summary> Sets all of the player's points at once. Used when restoring a saved game. </summary>
+///<param name="pointsTotal"> Player's total points. </param>
+///<param name="pointsThisRound"> Player's points this round. </param>
+///<param name="pointsThisTrick"> Player's points this trick. </param>
+///<returns> Nothing. </returns>
+inline void Player::setPoints(int pointsTotal, int pointsThisRound, int pointsThisTrick)
+{
+	m_pointsTotal = pointsTotal;
+	m_pointsThisRound = pointsThisRound;
+	m_pointsThisTrick = pointsThisTrick;
+}
+
 ///<summary> Getter for the player's points this round. </summary>
 ///<returns> Player's points this round. </returns>
 inline int Player::getPointsThisRound()
@@ -168,5 +195,6 @@ void Player::clearPointsThisTrick()
 inline void Player::clearRoundHand()
 {
 	m_roundHand.clear();
+	m_roundHandBits.clear();
 }
 #endif // !PLAYER_H
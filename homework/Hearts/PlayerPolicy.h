@@ -0,0 +1,45 @@
+#ifndef PLAYERPOLICY_H
+#define PLAYERPOLICY_H
+#include <vector>
+#include <string>
+#include "Card.h"
+#include "TrickState.h"
+
+///<summary>
+///Information about the game that a PlayerPolicy is allowed to see when it has to play a card.
+///All references are owned by the HeartsGame and are only valid for the duration of the call.
+///playedCards holds the cards from earlier tricks this round in the order they were played, and playedCardPlayers who played each one.
+///</summary>
+struct PlayView
+{
+	int playerIndex;
+	int numPlayers;
+	int passOffset;				// Cards were passed to the player this many seats after, 0 when cards were held this round
+	const TrickState &trickState;
+	const std::vector<Card> &hand;
+	const std::vector<Card> &playableCards;
+	const std::vector<Card> &trickCards;
+	const std::vector<int> &playerOrder;
+	const std::vector<Card> &playedCards;
+	const std::vector<int> &playedCardPlayers;
+	const std::vector<int> &pointsThisRound;
+};
+
+///<summary>
+///Interface for anything that can make decisions for a seat in a game of Hearts without a human at the console.
+///A HeartsGame asks the policy which cards to pass at the start of a round and which card to play on each turn.
+///Before each decision the game checks isReadyToPass() or isReadyToPlay(). A policy that cannot answer straight away, like a
+///client seat on a server, returns false and the game stops where it is until it is played again. Bots are always ready.
+///</summary>
+class PlayerPolicy
+{
+public:
+	virtual ~PlayerPolicy() {}
+	virtual std::string getName() = 0;
+	virtual std::vector<Card> chooseCardsToPass(const std::vector<Card> &hand, int playerIndex, int numPlayers, int passOffset, int numCards) = 0;
+	virtual Card chooseCardToPlay(const PlayView &view) = 0;
+	virtual bool isReadyToPass(const std::vector<Card> &/*hand*/, int /*playerIndex*/, int /*numPlayers*/, int /*passOffset*/, int /*numCards*/) { return true; }
+	virtual bool isReadyToPlay(const PlayView &/*view*/) { return true; }
+};
+
+#endif // !PLAYERPOLICY_H
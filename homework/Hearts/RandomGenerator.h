@@ -0,0 +1,160 @@
+#ifndef RANDOMGENERATOR_H
+#define RANDOMGENERATOR_H
+#include <cstdint>
+#include <random> // for random_device
+
+///<summary>
+///Small, fast random number generator (xoshiro256**) that each object can own, so nothing is shared between threads.
+///The 64 bit seed is spread over the 256 bit state with SplitMix64, so nearby seeds still give unrelated streams.
+///Meets the requirements of a C++ UniformRandomBitGenerator, so it also works with std::shuffle and the std distributions.
+///</summary>
+class RandomGenerator
+{
+public:
+	typedef uint64_t result_type;
+
+	RandomGenerator();
+	RandomGenerator(uint64_t seed);
+	~RandomGenerator();
+	void seed(uint64_t seed);
+	uint64_t next();
+	uint32_t nextBounded(uint32_t range);
+	uint64_t operator()();
+	static constexpr uint64_t min();
+	static constexpr uint64_t max();
+	void getState(uint64_t state[4]) const;
+	void setState(const uint64_t state[4]);
+
+private:
+	uint64_t m_state[4];
+	static uint64_t rotateLeft(uint64_t value, int count);
+};
+
+///<summary> Constructor for RandomGenerator object. Seeds the generator from std::random_device. </summary>
+///<returns> Nothing. </returns>
+inline RandomGenerator::RandomGenerator()
+{
+	std::random_device device;
+	seed((static_cast<uint64_t>(device()) << 32) | device());
+}
+
+///<summary> Constructor for RandomGenerator object. </summary>
+///<param name="seed"> Seed for the generator. The same seed always gives the same numbers. </param>
+///<returns> Nothing. </returns>
+inline RandomGenerator::RandomGenerator(uint64_t seed)
+{
+	this->seed(seed);
+}
+
+///<summary> Default destructor for RandomGenerator class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+inline RandomGenerator::~RandomGenerator()
+{
+}
+
+///<summary> Resets the generator's state from a seed using SplitMix64. </summary>
+///<param name="seed"> Seed for the generator. </param>
+///<returns> Nothing. </returns>
+inline void RandomGenerator::seed(uint64_t seed)
+{
+	for (int i = 0; i < 4; i++)
+	{
+		seed += 0x9E3779B97F4A7C15ULL;
+		uint64_t z = seed;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		m_state[i] = z ^ (z >> 31);
+	}
+}
+
+///<summary> Gets the next 64 random bits. </summary>
+///<returns> A uniformly distributed 64 bit number. </returns>
+inline uint64_t RandomGenerator::next()
+{
+	uint64_t result = rotateLeft(m_state[1] * 5, 7) * 9;
+	uint64_t t = m_state[1] << 17;
+	m_state[2] ^= m_state[0];
+	m_state[3] ^= m_state[1];
+	m_state[1] ^= m_state[2];
+	m_state[0] ^= m_state[3];
+	m_state[2] ^= t;
+	m_state[3] = rotateLeft(m_state[3], 45);
+	return result;
+}
+
+///<summary>
+///Gets a random number from 0 to range - 1 with every value equally likely.
+///Uses Lemire's multiply and shift method. Unlike 'next() % range' it has no bias toward low values,
+///and it only needs a division in the rare case where a draw has to be thrown away.
+///</summary>
+///<param name="range"> Number of possible values. Must be greater than zero. </param>
+///<returns> A uniformly distributed number from 0 to range - 1. </returns>
+inline uint32_t RandomGenerator::nextBounded(uint32_t range)
+{
+	uint64_t product = (next() >> 32) * range;
+	uint32_t low = static_cast<uint32_t>(product);
+	if (low < range)
+	{
+		uint32_t threshold = (0u - range) % range;
+		while (low < threshold)
+		{
+			product = (next() >> 32) * range;
+			low = static_cast<uint32_t>(product);
+		}
+	}
+	return static_cast<uint32_t>(product >> 32);
+}
+
+///<summary> Gets the next 64 random bits. Lets the generator be used with the standard library. </summary>
+///<returns> A uniformly distributed 64 bit number. </returns>
+inline uint64_t RandomGenerator::operator()()
+{
+	return next();
+}
+
+///<summary> Smallest value the generator can return. </summary>
+///<returns> Zero. </returns>
+constexpr uint64_t RandomGenerator::min()
+{
+	return 0;
+}
+
+///<summary> Largest value the generator can return. </summary>
+///<returns> The largest 64 bit number. </returns>
+constexpr uint64_t RandomGenerator::max()
+{
+	return UINT64_MAX;
+}
+
+///<summary> Copies out the generator's 256 bit state, so the numbers that follow can be reproduced later with setState(). </summary>
+///<param name="state"> Filled with the four words of the state. </param>
+///<returns> Nothing. </returns>
+inline void RandomGenerator::getState(uint64_t state[4]) const
+{
+	for (int i = 0; i < 4; i++)
+	{
+		state[i] = m_state[i];
+	}
+}
+
+///<summary> Puts back a state copied out with getState(). The generator then gives the same numbers it did from that point. </summary>
+///<param name="state"> The four words of the state. They must not all be zero. </param>
+///<returns> Nothing. </returns>
+inline void RandomGenerator::setState(const uint64_t state[4])
+{
+	for (int i = 0; i < 4; i++)
+	{
+		m_state[i] = state[i];
+	}
+}
+
+///<summary> Rotates the bits of a number to the left. </summary>
+///<param name="value"> Number to rotate. </param>
+///<param name="count"> Number of positions to rotate by (1-63). </param>
+///<returns> The rotated number. </returns>
+inline uint64_t RandomGenerator::rotateLeft(uint64_t value, int count)
+{
+	return (value << count) | (value >> (64 - count));
+}
+
+#endif // !RANDOMGENERATOR_H
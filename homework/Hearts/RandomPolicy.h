@@ -0,0 +1,80 @@
+#ifndef RANDOMPOLICY_H
+#define RANDOMPOLICY_H
+#include <vector>
+#include <string>
+#include "Card.h"
+#include "PlayerPolicy.h"
+#include "RandomGenerator.h"
+
+///<summary>
+///PlayerPolicy that passes and plays uniformly random legal cards. Useful as a baseline opponent.
+///</summary>
+class RandomPolicy : public PlayerPolicy
+{
+public:
+	RandomPolicy();
+	RandomPolicy(unsigned int seed);
+	~RandomPolicy();
+	std::string getName();
+	std::vector<Card> chooseCardsToPass(const std::vector<Card> &hand, int playerIndex, int numPlayers, int passOffset, int numCards);
+	Card chooseCardToPlay(const PlayView &view);
+
+private:
+	RandomGenerator m_generator;
+};
+
+///<summary> Constructor for RandomPolicy object. Seeds the generator from std::random_device. </summary>
+///<returns> Nothing. </returns>
+RandomPolicy::RandomPolicy()
+{
+}
+
+///<summary> Constructor for RandomPolicy object. </summary>
+///<param name="seed"> Seed for the random number generator so games can be reproduced. </param>
+///<returns> Nothing. </returns>
+RandomPolicy::RandomPolicy(unsigned int seed) : m_generator(seed)
+{
+}
+
+///<summary> Default destructor for RandomPolicy class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+RandomPolicy::~RandomPolicy()
+{
+}
+
+///<summary> Getter for the name of the policy. </summary>
+///<returns> The name of the policy. </returns>
+inline std::string RandomPolicy::getName()
+{
+	return "Random";
+}
+
+///<summary> Selects random cards from the hand to pass. </summary>
+///<param name="hand"> The player's current hand. </param>
+///<param name="playerIndex"> Index of the player passing cards. </param>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<param name="passOffset"> The cards go to the player this many seats after this one. </param>
+///<param name="numCards"> Number of cards to select. </param>
+///<returns> A vector of distinct cards from the hand. </returns>
+std::vector<Card> RandomPolicy::chooseCardsToPass(const std::vector<Card> &hand, int /*playerIndex*/, int /*numPlayers*/, int /*passOffset*/, int numCards)
+{
+	std::vector<Card> choices = hand;
+	std::vector<Card> passedCards;
+	for (int i = 0; i < numCards; i++)
+	{
+		int pos = m_generator.nextBounded(choices.size());
+		passedCards.push_back(choices.at(pos));
+		choices.erase(choices.begin() + pos);
+	}
+	return passedCards;
+}
+
+///<summary> Plays a random card out of the playable cards. </summary>
+///<param name="view"> The current state of the trick as seen by the player. </param>
+///<returns> The card to play. </returns>
+Card RandomPolicy::chooseCardToPlay(const PlayView &view)
+{
+	return view.playableCards.at(m_generator.nextBounded(view.playableCards.size()));
+}
+
+#endif // !RANDOMPOLICY_H
@@ -4,19 +4,46 @@
 // Homework 6
 
 #include <iostream>
+#include <chrono>
 #include "Card.h"
 #include "Deck.h"
 #include "Player.h"
 #include "InvalidCardPlayed.h"
 #include "HeartsGame.h"
+#include "RandomPolicy.h"
+#include "LowestCardPolicy.h"
+#include "HeuristicPolicy.h"
+#include "MonteCarloPolicy.h"
+#include "TournamentRunner.h"
+#include "HeartsBenchmark.h"
+#include "GameLog.h"
+#include "HeartsServer.h"
+#include "LoopbackClient.h"
 
 using namespace std;
 
+template <class Rules> void simulateGame(int numPlayers);
+void playAgainstComputer(int numPlayers);
+void runTournament(int numPlayers);
+void runBenchmark(int numPlayers);
+void recordAndReplay(int numPlayers);
+int countAcceptedCorruptRounds(const RoundRecord &record);
+void runServer(int numPlayers);
+
 int main()
 {
-	int numPlayers;
+	int numPlayers, mode;
 	bool valid;
 	cout << "Hearts" << '\n';
+	cout << "1. Play Game" << '\n';
+	cout << "2. Simulate Computer Players" << '\n';
+	cout << "3. Play Against Computer Players" << '\n';
+	cout << "4. Computer Player Tournament" << '\n';
+	cout << "5. Benchmark" << '\n';
+	cout << "6. Record and Replay Game Log" << '\n';
+	cout << "7. Multi-Table Server" << '\n';
+	cout << "What would you like to do? ";
+	cin >> mode;
 	do
 	{
 		cout << "How many players in the game? (3-5) ";
@@ -28,8 +55,338 @@ int main()
 		}
 	} while (!valid);
 
+	if (mode == 2)
+	{
+		int rules;
+		cout << "Which rules? (1 Standard, 2 Omnibus, 3 No shooting the moon) ";
+		cin >> rules;
+		if (rules == 2)
+		{
+			simulateGame<OmnibusRules>(numPlayers);
+		}
+		else if (rules == 3)
+		{
+			simulateGame<NoShootRules>(numPlayers);
+		}
+		else
+		{
+			simulateGame<StandardRules>(numPlayers);
+		}
+	}
+	else if (mode == 3)
+	{
+		playAgainstComputer(numPlayers);
+	}
+	else if (mode == 4)
+	{
+		runTournament(numPlayers);
+	}
+	else if (mode == 5)
+	{
+		runBenchmark(numPlayers);
+	}
+	else if (mode == 6)
+	{
+		recordAndReplay(numPlayers);
+	}
+	else if (mode == 7)
+	{
+		runServer(numPlayers);
+	}
+	else
+	{
+		HeartsGame game(numPlayers);
+		game.start();
+	}
+
+	return 0;
+}
+
+///<summary> Plays a headless game where every seat is a computer player, then reports the points and how fast the rounds were played. </summary>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<returns> Nothing. </returns>
+template <class Rules>
+void simulateGame(int numPlayers)
+{
+	int numRounds;
+	RandomPolicy randomPolicy;
+	LowestCardPolicy lowestCardPolicy;
+	HeuristicPolicy heuristicPolicy;
+	PlayerPolicy *policies[] = { &heuristicPolicy, &randomPolicy, &lowestCardPolicy };
+	BasicHeartsGame<Rules> game(numPlayers);
+
+	cout << "How many rounds to simulate? ";
+	cin >> numRounds;
+
+	game.setHeadless(true);
+	for (int i = 0; i < numPlayers; i++)
+	{
+		game.setPlayerPolicy(i, policies[i % 3]);
+	}
+
+	auto startTime = chrono::steady_clock::now();
+	game.simulateRounds(numRounds);
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+
+	for (int i = 0; i < numPlayers; i++)
+	{
+		cout << "Player " << i + 1 << " (" << policies[i % 3]->getName() << "): " << game.getPlayerPointsTotal(i) << " points" << '\n';
+	}
+	cout << numRounds << " rounds in " << elapsed.count() << " seconds (" << numRounds / elapsed.count() << " rounds/second)" << '\n';
+}
+
+///<summary> Plays a game where Player 1 is at the console and every other seat is a Monte Carlo computer player. </summary>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<returns> Nothing. </returns>
+void playAgainstComputer(int numPlayers)
+{
+	MonteCarloPolicy monteCarloPolicy;
 	HeartsGame game(numPlayers);
+
+	for (int i = 1; i < numPlayers; i++)
+	{
+		game.setPlayerPolicy(i, &monteCarloPolicy);
+	}
 	game.start();
+}
 
-	return 0;
+///<summary> Plays many games between the computer players across every core and reports how each one did. </summary>
+///<param name="numPlayers"> Number of players at each table. </param>
+///<returns> Nothing. </returns>
+void runTournament(int numPlayers)
+{
+	int numGames;
+	unsigned int seed;
+	TournamentRunner tournament(numPlayers);
+
+	cout << "How many games to play? ";
+	cin >> numGames;
+	cout << "Tournament seed? ";
+	cin >> seed;
+
+	tournament.addPolicy("Heuristic", [](unsigned int) -> PlayerPolicy* { return new HeuristicPolicy(); });
+	tournament.addPolicy("Random", [](unsigned int seed) -> PlayerPolicy* { return new RandomPolicy(seed); });
+	tournament.addPolicy("Lowest Card", [](unsigned int) -> PlayerPolicy* { return new LowestCardPolicy(); });
+	// Games already run in parallel, so each Monte Carlo player searches on a single thread
+	tournament.addPolicy("Monte Carlo", [](unsigned int seed) -> PlayerPolicy* { return new MonteCarloPolicy(100, 50, 1, seed); });
+
+	auto startTime = chrono::steady_clock::now();
+	tournament.run(numGames, seed);
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+
+	tournament.display();
+	cout << numGames << " games in " << elapsed.count() << " seconds (" << numGames / elapsed.count() << " games/second)" << '\n';
+}
+
+///<summary>
+///Times the engine's hot paths and reports the time each one takes.
+///The results can be compared against a baseline saved by an earlier run, and saved to become the next baseline.
+///</summary>
+///<param name="numPlayers"> Number of players to deal for. </param>
+///<returns> Nothing. </returns>
+void runBenchmark(int numPlayers)
+{
+	int iterations;
+	string baselineFile, resultsFile;
+	HeartsBenchmark benchmark(numPlayers);
+
+	cout << "How many iterations of each benchmark? ";
+	cin >> iterations;
+	cout << "Baseline file to compare against? (- for none) ";
+	cin >> baselineFile;
+	cout << "File to save results to? (- for none) ";
+	cin >> resultsFile;
+
+	if (baselineFile != "-" && !benchmark.loadBaseline(baselineFile))
+	{
+		cout << "Could not read " << baselineFile << '\n';
+	}
+	benchmark.run(iterations);
+	benchmark.display();
+	if (resultsFile != "-" && !benchmark.saveResults(resultsFile))
+	{
+		cout << "Could not write " << resultsFile << '\n';
+	}
+}
+
+///<summary> Logs a headless game of computer players to a file, then reads the whole log back and checks every round replays to the same points. </summary>
+///<param name="numPlayers"> Number of players in the game. </param>
+///<returns> Nothing. </returns>
+void recordAndReplay(int numPlayers)
+{
+	int numRounds;
+	string fileName;
+	RandomPolicy randomPolicy;
+	LowestCardPolicy lowestCardPolicy;
+	HeuristicPolicy heuristicPolicy;
+	PlayerPolicy *policies[] = { &heuristicPolicy, &randomPolicy, &lowestCardPolicy };
+	HeartsGame game(numPlayers);
+	GameLogWriter writer;
+	GameLogReader reader;
+
+	cout << "How many rounds to record? ";
+	cin >> numRounds;
+	cout << "Log file name? ";
+	cin >> fileName;
+
+	if (!writer.open(fileName, numPlayers))
+	{
+		cout << "Could not create " << fileName << '\n';
+		return;
+	}
+	game.setHeadless(true);
+	game.setGameLog(&writer);
+	for (int i = 0; i < numPlayers; i++)
+	{
+		game.setPlayerPolicy(i, policies[i % 3]);
+	}
+	game.simulateRounds(numRounds);
+	if (!writer.close())
+	{
+		cout << "Could not write all of " << fileName << '\n';
+		return;
+	}
+
+	if (!reader.open(fileName))
+	{
+		cout << "Could not read " << fileName << '\n';
+		return;
+	}
+	RoundRecord record;
+	ReplayState state;
+	long long mismatches = 0;
+	long long invalidRounds = 0;
+	auto startTime = chrono::steady_clock::now();
+	for (long long r = 0; r < reader.getNumRounds(); r++)
+	{
+		if (!reader.getRound(r, record) || !GameLogReader::replay(record, GameLogFormat::getHandSize(numPlayers), state))
+		{
+			invalidRounds++;
+			continue;
+		}
+		for (int p = 0; p < numPlayers; p++)
+		{
+			if (state.points[p] != record.points[p])
+			{
+				mismatches++;
+			}
+		}
+	}
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+
+	cout << reader.getNumRounds() << " rounds logged, " << GameLogFormat::getRecordSize(numPlayers) << " bytes per round" << '\n';
+	cout << "Replayed in " << elapsed.count() << " seconds (" << reader.getNumRounds() / elapsed.count() << " rounds/second), "
+		<< mismatches << " mismatched scores, " << invalidRounds << " invalid rounds" << '\n';
+	if (reader.getRound(0, record))
+	{
+		cout << "Corrupted copies of the first round accepted: " << countAcceptedCorruptRounds(record) << " (should be 0)" << '\n';
+	}
+}
+
+///<summary>
+///Damages a logged round in the ways a corrupt file could and counts how many of the damaged copies are still read as
+///valid rounds. Every one should be rejected, since replaying them would read or write outside the replay's tables.
+///</summary>
+///<param name="record"> A valid round with passing. </param>
+///<returns> Number of damaged copies that were accepted. </returns>
+int countAcceptedCorruptRounds(const RoundRecord &record)
+{
+	int numPlayers = record.numPlayers;
+	int passStart = GameLogFormat::DEAL_BYTES + 1;
+	int trickStart = passStart + 3 * numPlayers;
+	vector<uint8_t> bytes(GameLogFormat::getRecordSize(numPlayers));
+	GameLogFormat::encode(record, bytes.data());
+	// The first card played was certainly dealt, so changing who it was dealt to always damages the deal
+	int dealByte = bytes[trickStart] / 2;
+	int dealShift = (bytes[trickStart] % 2) * 4;
+	vector<vector<uint8_t>> copies(6, bytes);
+	copies[0][dealByte] = static_cast<uint8_t>((bytes[dealByte] & ~(0x0F << dealShift)) | (numPlayers << dealShift));	// Dealt to a player who is not there
+	copies[1][dealByte] = static_cast<uint8_t>(bytes[dealByte] | (0x0F << dealShift));	// Not dealt, so a hand is short
+	copies[2][passStart - 1] = static_cast<uint8_t>((bytes[passStart - 1] & 0x80) | 7);	// Passing to a seat past the table
+	copies[3][passStart - 1] = static_cast<uint8_t>((bytes[passStart - 1] & 0x80) | 1);	// Passing a card that is not a card
+	copies[3][passStart] = 255;
+	copies[4][trickStart] = 52;												// Playing a card that is not a card
+	copies[5][trickStart + 1] = bytes[trickStart];							// Playing the same card twice
+
+	int accepted = 0;
+	RoundRecord damaged;
+	ReplayState state;
+	for (const vector<uint8_t> &copy : copies)
+	{
+		if (GameLogFormat::decode(copy.data(), numPlayers, damaged) || GameLogReader::replay(damaged, GameLogFormat::getHandSize(numPlayers), state))
+		{
+			accepted++;
+		}
+	}
+	return accepted;
+}
+
+///<summary>
+///Hosts many tables at once on a fixed pool of workers. Some seats at each table are played by loopback clients that answer
+///through messages, the rest by heuristic bots. Reports how fast the games were played and how long replies waited for a worker.
+///</summary>
+///<param name="numPlayers"> Number of players at each table. </param>
+///<returns> Nothing. </returns>
+void runServer(int numPlayers)
+{
+	int numTables, numClientSeats, numThreads;
+	char strayChoice;
+	HeartsServer server(numPlayers);
+	LoopbackClient client(&server);
+
+	cout << "How many tables? ";
+	cin >> numTables;
+	cout << "How many seats at each table are clients? (0-" << numPlayers << ") ";
+	cin >> numClientSeats;
+	cout << "How many worker threads? (0 for one per core) ";
+	cin >> numThreads;
+	cout << "Follow every client answer with a stray reply? (y/n) ";
+	cin >> strayChoice;
+
+	if (numThreads > 0)
+	{
+		server.setNumThreads(numThreads);
+	}
+	client.setNumThreads(2);
+	client.setSendsStrayReplies(strayChoice == 'y' || strayChoice == 'Y');
+	for (int t = 0; t < numTables; t++)
+	{
+		int tableId = server.addTable(t + 1);
+		for (int i = 0; i < numPlayers; i++)
+		{
+			if (i < numClientSeats)
+			{
+				server.setClientSeat(tableId, i, client.getSender());
+			}
+			else
+			{
+				server.setBotSeat(tableId, i, new HeuristicPolicy());
+			}
+		}
+	}
+
+	auto startTime = chrono::steady_clock::now();
+	client.start();
+	server.start();
+	server.waitUntilFinished();
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+	server.stop();
+	client.stop();
+
+	ServerStats stats = server.getStats();
+	cout << stats.tablesFinished << " games (" << stats.roundsPlayed << " rounds) in " << elapsed.count() << " seconds ("
+		<< stats.roundsPlayed / elapsed.count() << " rounds/second)" << '\n';
+	cout << stats.slicesRun << " slices, longest " << stats.maxSliceNanoseconds / 1000.0 << " microseconds" << '\n';
+	cout << client.getRequestsAnswered() << " client requests answered, " << stats.rejectedReplies << " rejected, "
+		<< client.getGamesFinished() << " game over messages" << '\n';
+	if (client.getStrayRepliesSent() > 0)
+	{
+		cout << client.getStrayRepliesSent() << " stray replies sent, all " << numTables * numClientSeats
+			<< " client games " << (client.getGamesFinished() == numTables * numClientSeats ? "finished" : "did NOT finish") << '\n';
+	}
+	if (stats.resumes > 0)
+	{
+		cout << "Reply to table running again: average " << stats.totalResumeNanoseconds / stats.resumes / 1000.0
+			<< " microseconds, longest " << stats.maxResumeNanoseconds / 1000.0 << " microseconds" << '\n';
+	}
 }
@@ -0,0 +1,297 @@
+#ifndef TOURNAMENTRUNNER_H
+#define TOURNAMENTRUNNER_H
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <atomic>
+#include <functional>
+#include <algorithm> // for std::max()
+#include <cstdint>
+#include "HeartsGame.h"
+#include "PlayerPolicy.h"
+
+///<summary>
+///Totals collected for one policy over a tournament.
+///</summary>
+struct PolicyStats
+{
+	std::string name;
+	int seatsPlayed;			// One for every game the policy sat in, per seat
+	double wins;				// A tie for the lowest score splits the win
+	long long totalScore;		// Sum of final game scores
+	long long roundsPlayed;
+	long long moonShots;
+	std::vector<long long> scoreHistogram;	// Final game scores in buckets of SCORE_BUCKET_SIZE points
+};
+
+///<summary>
+///Plays many independent headless games of Hearts across a pool of threads and collects statistics for each policy.
+///Policies are added as factories because most policies keep state (random number generators, passed cards)
+///and every game needs its own copies. Each game is seeded from the tournament seed and its game number, so results
+///do not depend on which thread played which game, and threads only combine their totals once every game is finished.
+///</summary>
+class TournamentRunner
+{
+public:
+	static const int SCORE_BUCKET_SIZE = 10;
+	static const int NUM_SCORE_BUCKETS = 20;
+
+	TournamentRunner(int numPlayers);
+	~TournamentRunner();
+	void addPolicy(std::string name, std::function<PlayerPolicy*(unsigned int seed)> factory);
+	void setTargetScore(int targetScore);
+	void setNumThreads(int numThreads);
+	void run(int numGames, unsigned int seed);
+	std::vector<PolicyStats> getStats();
+	void display();
+
+private:
+	int m_numPlayers;
+	int m_targetScore;
+	int m_numThreads;
+	std::vector<std::string> m_policyNames;
+	std::vector<std::function<PlayerPolicy*(unsigned int seed)>> m_factories;
+	std::vector<PolicyStats> m_stats;
+
+	void playGame(int gameNumber, unsigned int seed, std::vector<PolicyStats> &stats);
+	static unsigned int mixSeed(unsigned int seed, int gameNumber, int stream);
+	static void addStats(PolicyStats &total, const PolicyStats &part);
+};
+
+///<summary> Constructor for TournamentRunner object. Games go to 100 points and use every hardware thread. </summary>
+///<param name="numPlayers"> Number of players at every table (3-5). </param>
+///<returns> Nothing. </returns>
+TournamentRunner::TournamentRunner(int numPlayers)
+{
+	m_numPlayers = numPlayers;
+	m_targetScore = 100;
+	m_numThreads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+///<summary> Default destructor for TournamentRunner class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+TournamentRunner::~TournamentRunner()
+{
+}
+
+///<summary> Adds a policy to the tournament. Seats are handed out to the policies in turn, rotating every game. </summary>
+///<param name="name"> Name to report the policy under. </param>
+///<param name="factory"> Creates a new policy for a single seat of a single game. The runner deletes it after the game. </param>
+///<returns> Nothing. </returns>
+void TournamentRunner::addPolicy(std::string name, std::function<PlayerPolicy*(unsigned int seed)> factory)
+{
+	m_policyNames.push_back(name);
+	m_factories.push_back(factory);
+}
+
+///<summary> Setter for the score that ends a game. </summary>
+///<param name="targetScore"> A game ends after the round where any player reaches this score. </param>
+///<returns> Nothing. </returns>
+inline void TournamentRunner::setTargetScore(int targetScore)
+{
+	m_targetScore = targetScore;
+}
+
+///<summary> Setter for the number of threads games are spread over. </summary>
+///<param name="numThreads"> Number of threads. </param>
+///<returns> Nothing. </returns>
+inline void TournamentRunner::setNumThreads(int numThreads)
+{
+	m_numThreads = std::max(1, numThreads);
+}
+
+///<summary>
+///Plays a number of games. Threads take the next unplayed game number until none are left, keeping their own totals.
+///</summary>
+///<param name="numGames"> Number of games to play. </param>
+///<param name="seed"> Seed for the whole tournament. The same seed gives the same games. </param>
+///<returns> Nothing. </returns>
+void TournamentRunner::run(int numGames, unsigned int seed)
+{
+	int numPolicies = m_factories.size();
+	std::atomic<int> nextGame(0);
+	std::vector<std::vector<PolicyStats>> threadStats(m_numThreads);
+
+	for (int t = 0; t < m_numThreads; t++)
+	{
+		threadStats.at(t).resize(numPolicies);
+		for (int p = 0; p < numPolicies; p++)
+		{
+			PolicyStats &stats = threadStats.at(t).at(p);
+			stats.name = m_policyNames.at(p);
+			stats.seatsPlayed = 0;
+			stats.wins = 0;
+			stats.totalScore = 0;
+			stats.roundsPlayed = 0;
+			stats.moonShots = 0;
+			stats.scoreHistogram.assign(NUM_SCORE_BUCKETS, 0);
+		}
+	}
+
+	auto worker = [&](int t)
+	{
+		for (int game = nextGame++; game < numGames; game = nextGame++)
+		{
+			playGame(game, seed, threadStats.at(t));
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < m_numThreads; t++)
+	{
+		threads.push_back(std::thread(worker, t));
+	}
+	for (std::thread &thread : threads)
+	{
+		thread.join();
+	}
+
+	m_stats = threadStats.at(0);
+	for (int t = 1; t < m_numThreads; t++)
+	{
+		for (int p = 0; p < numPolicies; p++)
+		{
+			addStats(m_stats.at(p), threadStats.at(t).at(p));
+		}
+	}
+}
+
+///<summary> Getter for the statistics of the last run. </summary>
+///<returns> One PolicyStats for each policy, in the order they were added. </returns>
+inline std::vector<PolicyStats> TournamentRunner::getStats()
+{
+	return m_stats;
+}
+
+///<summary> Displays the statistics of the last run on the console. </summary>
+///<returns> Nothing. </returns>
+void TournamentRunner::display()
+{
+	std::cout << std::left << std::setw(15) << "Policy" << std::setw(10) << "Seats" << std::setw(12) << "Win Rate"
+		<< std::setw(12) << "Avg Score" << std::setw(12) << "Moon Rate" << '\n';
+	for (PolicyStats &stats : m_stats)
+	{
+		int seats = std::max(1, stats.seatsPlayed);
+		std::cout << std::left << std::setw(15) << stats.name << std::setw(10) << stats.seatsPlayed
+			<< std::setw(12) << stats.wins / seats
+			<< std::setw(12) << static_cast<double>(stats.totalScore) / seats
+			<< std::setw(12) << static_cast<double>(stats.moonShots) / std::max(1LL, stats.roundsPlayed) << '\n';
+	}
+	std::cout << '\n' << "Final score distribution" << '\n';
+	std::cout << std::setw(10) << "Score";
+	for (PolicyStats &stats : m_stats)
+	{
+		std::cout << std::setw(15) << stats.name;
+	}
+	std::cout << '\n';
+	for (int b = 0; b < NUM_SCORE_BUCKETS; b++)
+	{
+		std::string label = std::to_string(b * SCORE_BUCKET_SIZE) + (b == NUM_SCORE_BUCKETS - 1 ? "+" : "-" + std::to_string((b + 1) * SCORE_BUCKET_SIZE - 1));
+		std::cout << std::setw(10) << label;
+		for (PolicyStats &stats : m_stats)
+		{
+			std::cout << std::setw(15) << stats.scoreHistogram.at(b);
+		}
+		std::cout << '\n';
+	}
+}
+
+///<summary> Plays one game to the target score and adds the results to a thread's totals. </summary>
+///<param name="gameNumber"> Number of the game in the tournament. Used for seat rotation and seeding. </param>
+///<param name="seed"> Seed for the whole tournament. </param>
+///<param name="stats"> The thread's totals, one per policy. </param>
+///<returns> Nothing. </returns>
+void TournamentRunner::playGame(int gameNumber, unsigned int seed, std::vector<PolicyStats> &stats)
+{
+	int numPolicies = m_factories.size();
+	HeartsGame game(m_numPlayers);
+	std::vector<PlayerPolicy*> policies(m_numPlayers);
+	std::vector<int> seatPolicy(m_numPlayers);
+
+	game.setHeadless(true);
+	game.setSeed(mixSeed(seed, gameNumber, 0));
+	for (int i = 0; i < m_numPlayers; i++)
+	{
+		seatPolicy.at(i) = (i + gameNumber) % numPolicies;
+		policies.at(i) = m_factories.at(seatPolicy.at(i))(mixSeed(seed, gameNumber, i + 1));
+		game.setPlayerPolicy(i, policies.at(i));
+	}
+
+	bool gameOver = false;
+	while (!gameOver)
+	{
+		game.simulateRounds(1);
+		for (int i = 0; i < m_numPlayers; i++)
+		{
+			if (game.getPlayerPointsTotal(i) >= m_targetScore)
+			{
+				gameOver = true;
+			}
+		}
+	}
+
+	int lowestScore = game.getPlayerPointsTotal(0);
+	int numWinners = 0;
+	for (int i = 1; i < m_numPlayers; i++)
+	{
+		lowestScore = std::min(lowestScore, game.getPlayerPointsTotal(i));
+	}
+	for (int i = 0; i < m_numPlayers; i++)
+	{
+		if (game.getPlayerPointsTotal(i) == lowestScore)
+		{
+			numWinners++;
+		}
+	}
+	for (int i = 0; i < m_numPlayers; i++)
+	{
+		PolicyStats &policyStats = stats.at(seatPolicy.at(i));
+		int score = game.getPlayerPointsTotal(i);
+		policyStats.seatsPlayed++;
+		policyStats.totalScore += score;
+		policyStats.roundsPlayed += game.getRoundsPlayed();
+		policyStats.moonShots += game.getShootTheMoonCount(i);
+		policyStats.scoreHistogram.at(std::min(score / SCORE_BUCKET_SIZE, NUM_SCORE_BUCKETS - 1))++;
+		if (score == lowestScore)
+		{
+			policyStats.wins += 1.0 / numWinners;
+		}
+		delete policies.at(i);
+	}
+}
+
+///<summary> Mixes the tournament seed with a game number and stream number (SplitMix64 finalizer) so every game and seat gets an unrelated seed. </summary>
+///<param name="seed"> Seed for the whole tournament. </param>
+///<param name="gameNumber"> Number of the game. </param>
+///<param name="stream"> 0 for the deck, seat + 1 for each seat's policy. </param>
+///<returns> The mixed seed. </returns>
+unsigned int TournamentRunner::mixSeed(unsigned int seed, int gameNumber, int stream)
+{
+	uint64_t z = (static_cast<uint64_t>(seed) << 32) ^ (static_cast<uint64_t>(gameNumber) << 3) ^ static_cast<uint64_t>(stream);
+	z += 0x9E3779B97F4A7C15ULL;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	z = z ^ (z >> 31);
+	return static_cast<unsigned int>(z);
+}
+
+///<summary> Adds one set of totals into another. </summary>
+///<param name="total"> Totals to add to. </param>
+///<param name="part"> Totals to add. </param>
+///<returns> Nothing. </returns>
+void TournamentRunner::addStats(PolicyStats &total, const PolicyStats &part)
+{
+	total.seatsPlayed += part.seatsPlayed;
+	total.wins += part.wins;
+	total.totalScore += part.totalScore;
+	total.roundsPlayed += part.roundsPlayed;
+	total.moonShots += part.moonShots;
+	for (size_t b = 0; b < total.scoreHistogram.size(); b++)
+	{
+		total.scoreHistogram.at(b) += part.scoreHistogram.at(b);
+	}
+}
+
+#endif // !TOURNAMENTRUNNER_H
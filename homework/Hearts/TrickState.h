@@ -0,0 +1,19 @@
+#ifndef TRICKSTATE_H
+#define TRICKSTATE_H
+#include "Card.h"
+
+///<summary>
+///Everything about the trick in progress that decides which cards a player may play.
+///Built by HeartsGame::getTrickState() and handed to HeartsGame::legalMoves().
+///</summary>
+struct TrickState
+{
+	bool isFirstTrickOfRound;	// The first trick must be led with the starting card
+	bool isLeadingCard;			// Whether the card being chosen is the first card of the trick
+	bool canPlayHearts;			// Whether Hearts have been broken this round
+	bool canLeadQofS;			// Whether the Queen of Spades may be played
+	Card::Suit leadingCardSuit;	// Only meaningful when isLeadingCard is false
+	Card startingCard;			// 2 of Clubs, or 3 of Clubs with 5 players
+};
+
+#endif // !TRICKSTATE_H
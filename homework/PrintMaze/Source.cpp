@@ -3,70 +3,50 @@
 #include <iostream>
 #include <string>
 #include <fstream>
+#include "MazeGrid.h"
 
 using namespace std;
 
-void getMaze(char mazeArray[10][10]);
-void displayMaze(char maze[10][10]);
+void getMaze(MazeGrid &maze);
+void displayMaze(const MazeGrid &maze);
 
 int main()
 {
-	char maze[10][10];
+	MazeGrid maze;
 	getMaze(maze);
 	displayMaze(maze);
 	return 0;
 }
 
-///<summary> Prompts user for file name (e.g., myFile.txt) then stores maze into 10 by 10 array. </summary>
-///<param name="mazeArray"> A 10 by 10 array. </param>
-///<returns> Nothing. 2D array returned in output parameter. </returns>
-void getMaze(char mazeArray[10][10])
+///<summary> Prompts user for file name (e.g., myFile.txt) then loads the maze from it. The size of the maze comes from the file. </summary>
+///<param name="maze"> The maze to load into. </param>
+///<returns> Nothing. Maze returned in output parameter. </returns>
+void getMaze(MazeGrid &maze)
 {
 	string mazePath;
-	ifstream mazeFile;
 
 	cout << "Enter your file name that stores the maze (including .txt): ";
 	getline(cin, mazePath);
 
-	mazeFile.open(mazePath);
-
-	if (!mazeFile)
+	if (!maze.load(mazePath))
 	{
 		cout << "Error opening file." << endl;
 	}
-	else
-	{
-		for (int i = 0; i < 10; i++)
-		{
-			string oneLine;
-			int j = 0;
-			// Get each line and iterate over it to store in array
-			getline(mazeFile, oneLine);
-			for (char piece : oneLine)
-			{
-				mazeArray[i][j] = piece;
-				j++;
-			}
-		}
-	}
-
-	mazeFile.close();
 
 	return;
 }
 
-///<summary> Displays the 10 by 10 maze given to it to the console. </summary>
-///<param name="maze"> A 10 by 10 array. </param>
+///<summary> Displays the maze given to it to the console. </summary>
+///<param name="maze"> The maze. </param>
 ///<returns> Nothing. </returns>
-void displayMaze(char maze[10][10])
+void displayMaze(const MazeGrid &maze)
 {
-	cout << "Here's the maze in the given file:" << endl;
-	for (int i = 0; i < 10; i++)
+	cout << "Here's the maze in the given file:" << '\n';
+	for (int i = 0; i < maze.getRows(); i++)
 	{
-		for (int j = 0; j < 10; j++)
-		{
-			cout << maze[i][j];
-		}
-		cout << endl;
+		// Rows are contiguous, so each is written in one go
+		cout.write(maze.getRow(i), maze.getColumns());
+		cout << '\n';
 	}
+	cout.flush();
 }
\ No newline at end of file
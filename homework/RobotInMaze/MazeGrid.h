@@ -0,0 +1,214 @@
+#ifndef MAZEGRID_H
+#define MAZEGRID_H
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstring> // for memchr() and memcpy()
+
+///<summary>
+///Maze of any size stored as one contiguous block of characters, row by row ('*' for a wall, ' ' for an open cell).
+///Cell (row, column) is at row * getColumns() + column, so a whole row can be read or written in one go.
+///load() reads the usual maze text files: one line per row, with the number of rows and columns worked out from the file.
+///</summary>
+class MazeGrid
+{
+public:
+	static constexpr char WALL_CHAR = '*';
+	static constexpr char OPEN_CHAR = ' ';
+	static constexpr char OUTSIDE_CHAR = '\0';	// Returned for cells off the edge of the maze
+
+	MazeGrid();
+	MazeGrid(int rows, int columns);
+	~MazeGrid();
+	bool load(const std::string &fileName);
+	int getRows() const;
+	int getColumns() const;
+	bool isInside(int row, int column) const;
+	bool isWall(int row, int column) const;
+	char get(int row, int column) const;
+	void set(int row, int column, char cell);
+	const char *getRow(int row) const;
+
+private:
+	static const int BLOCK_SIZE = 1 << 20; // Bytes read from the file at a time
+
+	int m_rows;
+	int m_columns;
+	std::vector<char> m_cells;
+};
+
+///<summary> Constructor for an empty MazeGrid with no rows or columns. </summary>
+///<returns> Nothing. </returns>
+inline MazeGrid::MazeGrid()
+{
+	m_rows = 0;
+	m_columns = 0;
+}
+
+///<summary> Constructor for a MazeGrid where every cell is open. </summary>
+///<param name="rows"> Number of rows. </param>
+///<param name="columns"> Number of columns. </param>
+///<returns> Nothing. </returns>
+inline MazeGrid::MazeGrid(int rows, int columns)
+{
+	m_rows = rows;
+	m_columns = columns;
+	m_cells.assign(static_cast<size_t>(rows) * columns, OPEN_CHAR);
+}
+
+///<summary> Default destructor for MazeGrid class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+inline MazeGrid::~MazeGrid()
+{
+}
+
+///<summary>
+///Reads a maze from a text file, one line per row. The maze is as wide as the longest line, and shorter lines are
+///filled out with open cells. A '\r' before a line break is ignored, so files saved on Windows read the same.
+///The file is read in large blocks and the lines are copied straight into the grid, without a std::string for each line.
+///</summary>
+///<param name="fileName"> Name of the file to read. </param>
+///<returns> True if the file was read, otherwise false. The maze is left empty if the file could not be opened. </returns>
+bool MazeGrid::load(const std::string &fileName)
+{
+	std::ifstream file(fileName, std::ios::binary);
+	m_rows = 0;
+	m_columns = 0;
+	m_cells.clear();
+	if (!file)
+	{
+		return false;
+	}
+
+	// Lines are packed end to end first, since the width is not known until the longest line has been read
+	std::vector<char> block(BLOCK_SIZE);
+	std::vector<char> packed;
+	std::vector<int> lineLengths;
+	int lineLength = 0;
+	bool isLineOpen = false;
+	while (file)
+	{
+		file.read(block.data(), BLOCK_SIZE);
+		size_t blockSize = file.gcount();
+		size_t start = 0;
+		while (start < blockSize)
+		{
+			const char *lineEnd = static_cast<const char*>(std::memchr(block.data() + start, '\n', blockSize - start));
+			size_t end = (lineEnd != nullptr) ? lineEnd - block.data() : blockSize;
+			packed.insert(packed.end(), block.data() + start, block.data() + end);
+			lineLength += end - start;
+			isLineOpen = true;
+			if (lineEnd == nullptr)
+			{
+				break;
+			}
+			if (lineLength > 0 && packed.back() == '\r')
+			{
+				packed.pop_back();
+				lineLength--;
+			}
+			lineLengths.push_back(lineLength);
+			lineLength = 0;
+			isLineOpen = false;
+			start = end + 1;
+		}
+	}
+	// The last line only counts if it has something in it, so a file ending in a line break has no empty last row
+	if (isLineOpen && lineLength > 0)
+	{
+		if (packed.back() == '\r')
+		{
+			packed.pop_back();
+			lineLength--;
+		}
+		lineLengths.push_back(lineLength);
+	}
+
+	m_rows = lineLengths.size();
+	for (int length : lineLengths)
+	{
+		m_columns = (length > m_columns) ? length : m_columns;
+	}
+	if (packed.size() == static_cast<size_t>(m_rows) * m_columns)
+	{
+		// Every line is the same length, so the packed lines already are the grid
+		m_cells.swap(packed);
+		return true;
+	}
+	m_cells.assign(static_cast<size_t>(m_rows) * m_columns, OPEN_CHAR);
+	size_t offset = 0;
+	for (int row = 0; row < m_rows; row++)
+	{
+		std::memcpy(m_cells.data() + static_cast<size_t>(row) * m_columns, packed.data() + offset, lineLengths.at(row));
+		offset += lineLengths.at(row);
+	}
+	return true;
+}
+
+///<summary> Getter for the number of rows. </summary>
+///<returns> Number of rows in the maze. </returns>
+inline int MazeGrid::getRows() const
+{
+	return m_rows;
+}
+
+///<summary> Getter for the number of columns. </summary>
+///<returns> Number of columns in the maze. </returns>
+inline int MazeGrid::getColumns() const
+{
+	return m_columns;
+}
+
+///<summary> Determines whether a position is on the maze. </summary>
+///<param name="row"> Row of the position. </param>
+///<param name="column"> Column of the position. </param>
+///<returns> True if the position is inside the maze, otherwise false. </returns>
+inline bool MazeGrid::isInside(int row, int column) const
+{
+	return row >= 0 && row < m_rows && column >= 0 && column < m_columns;
+}
+
+///<summary> Determines whether a cell is a wall. </summary>
+///<param name="row"> Row of the cell. </param>
+///<param name="column"> Column of the cell. </param>
+///<returns> True if the cell is a wall, false if it is open or off the maze. </returns>
+inline bool MazeGrid::isWall(int row, int column) const
+{
+	return MazeGrid::get(row, column) == WALL_CHAR;
+}
+
+///<summary> Getter for a cell. </summary>
+///<param name="row"> Row of the cell. </param>
+///<param name="column"> Column of the cell. </param>
+///<returns> The character in the cell, or OUTSIDE_CHAR if the cell is off the maze. </returns>
+inline char MazeGrid::get(int row, int column) const
+{
+	if (!MazeGrid::isInside(row, column))
+	{
+		return OUTSIDE_CHAR;
+	}
+	return m_cells[static_cast<size_t>(row) * m_columns + column];
+}
+
+///<summary> Setter for a cell. Cells off the maze are ignored. </summary>
+///<param name="row"> Row of the cell. </param>
+///<param name="column"> Column of the cell. </param>
+///<param name="cell"> The character to put in the cell. </param>
+///<returns> Nothing. </returns>
+inline void MazeGrid::set(int row, int column, char cell)
+{
+	if (MazeGrid::isInside(row, column))
+	{
+		m_cells[static_cast<size_t>(row) * m_columns + column] = cell;
+	}
+}
+
+///<summary> Getter for a whole row, for printing or scanning it in one go. </summary>
+///<param name="row"> Row to get. Must be inside the maze. </param>
+///<returns> Pointer to the first of the row's getColumns() characters. </returns>
+inline const char *MazeGrid::getRow(int row) const
+{
+	return m_cells.data() + static_cast<size_t>(row) * m_columns;
+}
+
+#endif // !MAZEGRID_H
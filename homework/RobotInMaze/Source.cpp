@@ -8,36 +8,47 @@
 #include <cstdlib> // for rand()
 #include <algorithm> // for remove()
 #include <vector> // for begin() and end()
+#include "MazeGrid.h"
 
 using namespace std;
 
-const int MAX_SIZE = 10;
-const char MAZE_CHAR = '*';
-
-void createMaze(char mazeArray[][MAX_SIZE], int columns, int rows);
-void showMaze(char maze[][MAX_SIZE], int robotCol, int robotRow);
-void robot(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextColumn, int &nextRow);
-bool isValidMove(char maze[][MAX_SIZE], int column, int row);
+bool createMaze(MazeGrid &maze);
+void getStartAndEndCoordinates(const MazeGrid &maze, int &startRow, int &startColumn, int &endRow, int &endColumn);
+bool isReachable(const MazeGrid &maze, int startRow, int startColumn, int endRow, int endColumn);
+void showMaze(const MazeGrid &maze, int robotCol, int robotRow);
+void robot(const MazeGrid &maze, int lastColumn, int lastRow, int &nextColumn, int &nextRow);
+bool isValidMove(const MazeGrid &maze, int column, int row);
 
 int main()
 {
-	int startRow = 1,
-		startColumn = 0,
-		endRow = 9,
-		endColumn = 4,
+	int startRow,
+		startColumn,
+		endRow,
+		endColumn,
 		lastColumn,
 		lastRow,
 		nextColumn,
 		nextRow,
 		moves = 0;
-	char maze[MAX_SIZE][MAX_SIZE];
-	bool done = false;
-	createMaze(maze, MAX_SIZE, MAX_SIZE);
+	MazeGrid maze;
+	bool done;
+	if (!createMaze(maze))
+	{
+		return 1;
+	}
+	getStartAndEndCoordinates(maze, startRow, startColumn, endRow, endColumn);
+	// The random walk only stops when it reaches the end, so make sure it can
+	if (!isReachable(maze, startRow, startColumn, endRow, endColumn))
+	{
+		cout << "The end can't be reached from the start." << endl;
+		return 1;
+	}
 	showMaze(maze, startColumn, startRow);
 	lastColumn = startColumn;
 	lastRow = startRow;
+	done = startColumn == endColumn && startRow == endRow;
 
-	do
+	while (!done)
 	{
 		robot(maze, lastColumn, lastRow, nextColumn, nextRow);
 		// pause half second and clear the screen
@@ -53,72 +64,137 @@ int main()
 		}
 
 		moves++;
-	} while (!done);
+	}
 
 	cout << "Moves to complete the maze: " << moves << endl;
 
 	return 0;
 }
 
-///<summary> Prompts user for file name (e.g., myFile.txt) then stores maze into 10 by 10 array. </summary>
-///<param name="mazeArray"> A 10 by 10 array. </param>
-///<returns> Nothing. 2D array returned in output parameter. </returns>
-void createMaze(char mazeArray[][MAX_SIZE], int columns, int rows)
+///<summary> Prompts user for file name (e.g., myFile.txt) then loads the maze from it. The size of the maze comes from the file. </summary>
+///<param name="maze"> The maze to load into. </param>
+///<returns> True if the maze was loaded, otherwise false. Maze returned in output parameter. </returns>
+bool createMaze(MazeGrid &maze)
 {
 	string mazePath;
-	ifstream mazeFile;
 
 	cout << "Enter your file name that stores the maze (including .txt): ";
 	getline(cin, mazePath);
 
-	mazeFile.open(mazePath);
-
-	if (!mazeFile)
+	if (!maze.load(mazePath) || maze.getRows() == 0)
 	{
 		cout << "Error opening file." << endl;
+		return false;
 	}
-	else
+
+	return true;
+}
+
+///<summary> Prompts user for the start row/column and end row/column for the maze. </summary>
+///<param name="maze"> The maze. </param>
+///<param name="startRow"> The start row position of the maze. </param>
+///<param name="startColumn"> The start column position of the maze. </param>
+///<param name="endRow"> The end row position of the maze. </param>
+///<param name="endColumn"> The end column position of the maze. </param>
+///<returns> Nothing </returns>
+void getStartAndEndCoordinates(const MazeGrid &maze, int &startRow, int &startColumn, int &endRow, int &endColumn)
+{
+	bool valid = false;
+
+	while (!valid)
 	{
-		for (int i = 0; i < columns; i++)
+		cout << "What is the starting row for the robot? ";
+		cin >> startRow;
+		cout << "What is the starting column for the robot? ";
+		cin >> startColumn;
+		valid = isValidMove(maze, startColumn, startRow);
+		if (!valid)
 		{
-			string oneLine;
-			// Get each line and iterate over it to store in array
-			getline(mazeFile, oneLine);
-			for (int j = 0; j < rows; j++)
-			{
-				mazeArray[i][j] = oneLine[j];
-			}
+			cout << "Invalid input" << endl;
 		}
 	}
 
-	mazeFile.close();
-
-	return;
+	valid = false;
+	while (!valid)
+	{
+		cout << "What is the ending row for the robot? ";
+		cin >> endRow;
+		cout << "What is the ending column for the robot? ";
+		cin >> endColumn;
+		valid = isValidMove(maze, endColumn, endRow);
+		if (!valid)
+		{
+			cout << "Invalid input" << endl;
+		}
+	}
 }
 
-///<summary> Displays the 10 by 10 maze given to it to the console. </summary>
-///<param name="maze"> A 10 by 10 array. </param>
-///<returns> Nothing. </returns>
-void showMaze(char maze[][MAX_SIZE], int robotCol, int robotRow)
+///<summary> Determines whether the robot can get from the start to the end, by filling out from the start. </summary>
+///<param name="maze"> The maze. </param>
+///<param name="startRow"> The start row position of the maze. </param>
+///<param name="startColumn"> The start column position of the maze. </param>
+///<param name="endRow"> The end row position of the maze. </param>
+///<param name="endColumn"> The end column position of the maze. </param>
+///<returns> True if there is a path from the start to the end, otherwise false. </returns>
+bool isReachable(const MazeGrid &maze, int startRow, int startColumn, int endRow, int endColumn)
 {
-	for (int i = 0; i < MAX_SIZE; i++)
+	const int rowSteps[4] = { -1, 1, 0, 0 };
+	const int columnSteps[4] = { 0, 0, -1, 1 };
+	vector<bool> reached(static_cast<size_t>(maze.getRows()) * maze.getColumns(), false);
+	// Cells still to look out from, kept on a vector rather than by recursion so a big maze cannot overflow the stack
+	vector<int> toVisit;
+
+	reached.at(static_cast<size_t>(startRow) * maze.getColumns() + startColumn) = true;
+	toVisit.push_back(startRow * maze.getColumns() + startColumn);
+	while (!toVisit.empty())
 	{
-		for (int j = 0; j < MAX_SIZE; j++)
+		int row = toVisit.back() / maze.getColumns();
+		int column = toVisit.back() % maze.getColumns();
+		toVisit.pop_back();
+		if (row == endRow && column == endColumn)
 		{
-			if (i == robotRow && j == robotCol)
-			{
-				cout << "X";
-			}
-			else
+			return true;
+		}
+		for (int d = 0; d < 4; d++)
+		{
+			int nextRow = row + rowSteps[d];
+			int nextColumn = column + columnSteps[d];
+			if (isValidMove(maze, nextColumn, nextRow) && !reached.at(static_cast<size_t>(nextRow) * maze.getColumns() + nextColumn))
 			{
-				cout << maze[i][j];
+				reached.at(static_cast<size_t>(nextRow) * maze.getColumns() + nextColumn) = true;
+				toVisit.push_back(nextRow * maze.getColumns() + nextColumn);
 			}
 		}
-		cout << endl;
 	}
+	return false;
+}
+
+///<summary> Displays the maze given to it to the console, with the robot marked as an X. </summary>
+///<param name="maze"> The maze. </param>
+///<param name="robotCol"> The current column the robot is in. </param>
+///<param name="robotRow"> The current row the robot is in. </param>
+///<returns> Nothing. </returns>
+void showMaze(const MazeGrid &maze, int robotCol, int robotRow)
+{
+	for (int i = 0; i < maze.getRows(); i++)
+	{
+		// Rows are contiguous, so each is written in one go apart from the robot
+		if (i == robotRow)
+		{
+			cout.write(maze.getRow(i), robotCol);
+			cout << "X";
+			cout.write(maze.getRow(i) + robotCol + 1, maze.getColumns() - robotCol - 1);
+		}
+		else
+		{
+			cout.write(maze.getRow(i), maze.getColumns());
+		}
+		cout << '\n';
+	}
+	cout.flush();
 }
 
-void robot(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextColumn, int &nextRow)
+void robot(const MazeGrid &maze, int lastColumn, int lastRow, int &nextColumn, int &nextRow)
 {
 	int max = 4;
 	bool validMove = false;
@@ -171,17 +247,13 @@ void robot(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextColumn,
 	}
 }
 
-bool isValidMove(char maze[][MAX_SIZE], int column, int row)
+bool isValidMove(const MazeGrid &maze, int column, int row)
 {
-	if (maze[row][column] == MAZE_CHAR)
-	{
-		return false;
-	}
-	else if (column < 0 || column > MAX_SIZE - 1)
+	if (!maze.isInside(row, column))
 	{
 		return false;
 	}
-	else if (row < 0 || row > MAX_SIZE - 1)
+	else if (maze.isWall(row, column))
 	{
 		return false;
 	}
@@ -190,7 +262,6 @@ bool isValidMove(char maze[][MAX_SIZE], int column, int row)
 		return true;
 	}
 	// It's not valid if
-	// 1. The character we're moving to is a MAZE_CHAR
-	// 2. The position is less than 0 (off the maze to the left or up)
-	// 3. The position is greater than MAX_SIZE - 1 (off the maze to the right or down)
+	// 1. The position is off the maze (checked first so the maze is never read outside its cells)
+	// 2. The character we're moving to is a wall
 }
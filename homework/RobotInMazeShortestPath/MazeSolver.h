@@ -0,0 +1,391 @@
+#ifndef MAZESOLVER_H
+#define MAZESOLVER_H
+#include <vector>
+#include <algorithm> // for fill(), reverse(), push_heap() and pop_heap()
+#include <limits>
+#include <cstdlib> // for abs()
+#include "WallBitmap.h"
+
+///<summary> A cell of the maze on a path. </summary>
+struct MazeCell
+{
+	int row;
+	int column;
+};
+
+///<summary> A cell waiting in the A* open list, with its cost so far and its estimate of the whole path through it. </summary>
+struct OpenEntry
+{
+	int estimate;
+	int cost;
+	int cell;
+};
+
+///<summary>
+///Finds the shortest path between two cells of a maze, moving up, down, left, or right one cell at a time.
+///Cells are numbered row * columns + column, so all the search state lives in flat arrays sized once for the maze and
+///reused by every solve: nothing is allocated per cell while searching.
+///</summary>
+class MazeSolver
+{
+public:
+	MazeSolver(const WallBitmap &walls);
+	~MazeSolver();
+	int solveBreadthFirst(int startRow, int startColumn, int endRow, int endColumn);
+	int solveAStar(int startRow, int startColumn, int endRow, int endColumn);
+	int solveJumpPoint(int startRow, int startColumn, int endRow, int endColumn);
+	const std::vector<MazeCell> &getPath() const;
+	int getPathLength() const;
+	long long getNumExpanded() const;
+
+private:
+	static constexpr int NO_PARENT = -1;
+	static constexpr int NO_CELL = -1;
+	static constexpr int NO_COST = std::numeric_limits<int>::max();
+
+	const WallBitmap &m_walls;
+	int m_columns;
+	std::vector<int> m_parent;		// Cell each cell was first reached from, NO_PARENT if it has not been reached
+	std::vector<int> m_frontier;	// Cells waiting to be expanded, in the order they were reached
+	std::vector<int> m_cost;		// Cheapest cost found so far to reach each cell, NO_COST if it has not been reached
+	std::vector<OpenEntry> m_open;	// Binary heap of cells waiting to be expanded, lowest estimate first
+	std::vector<MazeCell> m_path;
+	long long m_numExpanded;
+
+	void reset();
+	int search(int startRow, int startColumn, int endRow, int endColumn, bool isJumping);
+	int jump(int row, int column, int rowStep, int columnStep, int endCell) const;
+	int distance(int cell, int otherCell) const;
+	void pushOpen(int cell, int cost, int endCell);
+	OpenEntry popOpen();
+	static bool isLowerPriority(const OpenEntry &entry, const OpenEntry &otherEntry);
+	void buildPath(int startCell, int endCell);
+};
+
+///<summary> Constructor for a MazeSolver of a maze. The walls must outlive the solver. </summary>
+///<param name="walls"> The maze's walls. </param>
+///<returns> Nothing. </returns>
+MazeSolver::MazeSolver(const WallBitmap &walls) : m_walls(walls)
+{
+	size_t numCells = static_cast<size_t>(walls.getRows()) * walls.getColumns();
+	m_columns = walls.getColumns();
+	m_parent.assign(numCells, NO_PARENT);
+	// Every cell goes into the frontier at most once, so it never needs to grow
+	m_frontier.resize(numCells);
+	m_cost.assign(numCells, NO_COST);
+	m_numExpanded = 0;
+}
+
+///<summary> Default destructor for MazeSolver class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+inline MazeSolver::~MazeSolver()
+{
+}
+
+///<summary>
+///Finds a shortest path with a breadth-first search. The frontier is a plain array with a read and a write position:
+///cells are expanded in the order they were reached, so the first time the end is reached is by a shortest path.
+///</summary>
+///<param name="startRow"> Row of the start. Must be an open cell. </param>
+///<param name="startColumn"> Column of the start. Must be an open cell. </param>
+///<param name="endRow"> Row of the end. Must be an open cell. </param>
+///<param name="endColumn"> Column of the end. Must be an open cell. </param>
+///<returns> Number of moves on the shortest path, or -1 if the end cannot be reached. </returns>
+int MazeSolver::solveBreadthFirst(int startRow, int startColumn, int endRow, int endColumn)
+{
+	MazeSolver::reset();
+	// Moving up, right, down, or left changes the cell number by these, in the bit order of openNeighbors()
+	const int offsets[4] = { -m_columns, 1, m_columns, -1 };
+	int startCell = startRow * m_columns + startColumn;
+	int endCell = endRow * m_columns + endColumn;
+	int read = 0;
+	int write = 0;
+
+	m_parent[startCell] = startCell;
+	m_frontier[write++] = startCell;
+	while (read < write)
+	{
+		int cell = m_frontier[read++];
+		m_numExpanded++;
+		if (cell == endCell)
+		{
+			MazeSolver::buildPath(startCell, endCell);
+			return MazeSolver::getPathLength();
+		}
+		int open = m_walls.openNeighbors(cell / m_columns, cell % m_columns);
+		for (int direction = 0; direction < 4; direction++)
+		{
+			int next = cell + offsets[direction];
+			if (((open >> direction) & 1) && m_parent[next] == NO_PARENT)
+			{
+				m_parent[next] = cell;
+				m_frontier[write++] = next;
+			}
+		}
+	}
+	return -1;
+}
+
+///<summary>
+///Finds a shortest path with an A* search, expanding the cell with the lowest cost so far plus Manhattan distance
+///to the end first. The Manhattan distance never overestimates when moves are up, down, left, or right, so the path is
+///still the shortest, but the search heads towards the end instead of spreading out evenly like breadth-first.
+///</summary>
+///<param name="startRow"> Row of the start. Must be an open cell. </param>
+///<param name="startColumn"> Column of the start. Must be an open cell. </param>
+///<param name="endRow"> Row of the end. Must be an open cell. </param>
+///<param name="endColumn"> Column of the end. Must be an open cell. </param>
+///<returns> Number of moves on the shortest path, or -1 if the end cannot be reached. </returns>
+inline int MazeSolver::solveAStar(int startRow, int startColumn, int endRow, int endColumn)
+{
+	return MazeSolver::search(startRow, startColumn, endRow, endColumn, false);
+}
+
+///<summary>
+///Finds a shortest path with Jump Point Search: A* where, instead of stepping to each neighbor, the search runs in a
+///straight line until it reaches a cell where the path could need to turn (a jump point). Only jump points go into the
+///open list, so on open mazes with long corridors and rooms far fewer cells are expanded than by A* or breadth-first.
+///Every move costs the same, which is what lets whole runs of cells be skipped.
+///</summary>
+///<param name="startRow"> Row of the start. Must be an open cell. </param>
+///<param name="startColumn"> Column of the start. Must be an open cell. </param>
+///<param name="endRow"> Row of the end. Must be an open cell. </param>
+///<param name="endColumn"> Column of the end. Must be an open cell. </param>
+///<returns> Number of moves on the shortest path, or -1 if the end cannot be reached. </returns>
+inline int MazeSolver::solveJumpPoint(int startRow, int startColumn, int endRow, int endColumn)
+{
+	return MazeSolver::search(startRow, startColumn, endRow, endColumn, true);
+}
+
+///<summary> Getter for the path found by the last solve, from the start to the end. Empty if there was no path. </summary>
+///<returns> The cells on the path, including the start and the end. </returns>
+inline const std::vector<MazeCell> &MazeSolver::getPath() const
+{
+	return m_path;
+}
+
+///<summary> Getter for the length of the path found by the last solve. </summary>
+///<returns> Number of moves on the path, or -1 if there was no path. </returns>
+inline int MazeSolver::getPathLength() const
+{
+	return static_cast<int>(m_path.size()) - 1;
+}
+
+///<summary> Getter for how many cells the last solve expanded, to compare how much of the maze each search looks at. </summary>
+///<returns> Number of cells expanded. </returns>
+inline long long MazeSolver::getNumExpanded() const
+{
+	return m_numExpanded;
+}
+
+///<summary> Clears the state left by the last solve. </summary>
+///<returns> Nothing. </returns>
+void MazeSolver::reset()
+{
+	std::fill(m_parent.begin(), m_parent.end(), NO_PARENT);
+	std::fill(m_cost.begin(), m_cost.end(), NO_COST);
+	m_open.clear();
+	m_path.clear();
+	m_numExpanded = 0;
+}
+
+///<summary>
+///The A* search shared by solveAStar() and solveJumpPoint(). A cell can be pushed again when a cheaper way to it is
+///found, and the old entry is skipped when it comes out of the heap, which is cheaper than finding and updating it.
+///</summary>
+///<param name="startRow"> Row of the start. </param>
+///<param name="startColumn"> Column of the start. </param>
+///<param name="endRow"> Row of the end. </param>
+///<param name="endColumn"> Column of the end. </param>
+///<param name="isJumping"> True to move between jump points, false to move one cell at a time. </param>
+///<returns> Number of moves on the shortest path, or -1 if the end cannot be reached. </returns>
+int MazeSolver::search(int startRow, int startColumn, int endRow, int endColumn, bool isJumping)
+{
+	MazeSolver::reset();
+	// Up, right, down, and left, in the bit order of openNeighbors()
+	const int rowSteps[4] = { -1, 0, 1, 0 };
+	const int columnSteps[4] = { 0, 1, 0, -1 };
+	int startCell = startRow * m_columns + startColumn;
+	int endCell = endRow * m_columns + endColumn;
+
+	m_parent[startCell] = startCell;
+	m_cost[startCell] = 0;
+	MazeSolver::pushOpen(startCell, 0, endCell);
+	while (!m_open.empty())
+	{
+		OpenEntry entry = MazeSolver::popOpen();
+		if (entry.cost > m_cost[entry.cell])
+		{
+			continue;
+		}
+		m_numExpanded++;
+		if (entry.cell == endCell)
+		{
+			MazeSolver::buildPath(startCell, endCell);
+			return MazeSolver::getPathLength();
+		}
+
+		int row = entry.cell / m_columns;
+		int column = entry.cell % m_columns;
+		int open = m_walls.openNeighbors(row, column);
+		int parentRow = m_parent[entry.cell] / m_columns;
+		int parentColumn = m_parent[entry.cell] % m_columns;
+		for (int direction = 0; direction < 4; direction++)
+		{
+			if (((open >> direction) & 1) == 0)
+			{
+				continue;
+			}
+			// Going straight back towards the parent can never be part of a shorter path
+			if ((rowSteps[direction] != 0 && rowSteps[direction] == parentRow - row && column == parentColumn)
+				|| (columnSteps[direction] != 0 && columnSteps[direction] == parentColumn - column && row == parentRow))
+			{
+				continue;
+			}
+			int next = (row + rowSteps[direction]) * m_columns + column + columnSteps[direction];
+			if (isJumping)
+			{
+				next = MazeSolver::jump(row, column, rowSteps[direction], columnSteps[direction], endCell);
+				if (next == NO_CELL)
+				{
+					continue;
+				}
+			}
+			int cost = entry.cost + MazeSolver::distance(entry.cell, next);
+			if (cost < m_cost[next])
+			{
+				m_cost[next] = cost;
+				m_parent[next] = entry.cell;
+				MazeSolver::pushOpen(next, cost, endCell);
+			}
+		}
+	}
+	return -1;
+}
+
+///<summary>
+///Runs in a straight line from a cell until it finds a jump point: the end, or a cell where a shortest path may turn.
+///Running left or right, that is a cell with an open cell above or below it that was a wall beside the cell before it,
+///since no shorter path can reach that opening without passing through here. Running up or down, it is the same with the
+///cells left and right, or any cell with a jump point along its row, since paths go up or down first and then across.
+///The maze's border is walls, so every run stops at the edge without checking bounds.
+///</summary>
+///<param name="row"> Row of the cell to run from. </param>
+///<param name="column"> Column of the cell to run from. </param>
+///<param name="rowStep"> -1 to run up, 1 to run down, or 0 to run across. </param>
+///<param name="columnStep"> -1 to run left, 1 to run right, or 0 to run up or down. </param>
+///<param name="endCell"> Cell number of the end. </param>
+///<returns> Cell number of the jump point, or NO_CELL if the run ends at a wall first. </returns>
+int MazeSolver::jump(int row, int column, int rowStep, int columnStep, int endCell) const
+{
+	while (true)
+	{
+		row += rowStep;
+		column += columnStep;
+		if (!m_walls.isOpen(row, column))
+		{
+			return NO_CELL;
+		}
+		int cell = row * m_columns + column;
+		if (cell == endCell)
+		{
+			return cell;
+		}
+		if (columnStep != 0)
+		{
+			if ((m_walls.isOpen(row - 1, column) && !m_walls.isOpen(row - 1, column - columnStep))
+				|| (m_walls.isOpen(row + 1, column) && !m_walls.isOpen(row + 1, column - columnStep)))
+			{
+				return cell;
+			}
+		}
+		else
+		{
+			if ((m_walls.isOpen(row, column - 1) && !m_walls.isOpen(row - rowStep, column - 1))
+				|| (m_walls.isOpen(row, column + 1) && !m_walls.isOpen(row - rowStep, column + 1)))
+			{
+				return cell;
+			}
+			if (MazeSolver::jump(row, column, 0, 1, endCell) != NO_CELL || MazeSolver::jump(row, column, 0, -1, endCell) != NO_CELL)
+			{
+				return cell;
+			}
+		}
+	}
+}
+
+///<summary> Finds the Manhattan distance between two cells: the moves between them if there were no walls. </summary>
+///<param name="cell"> Cell number of one cell. </param>
+///<param name="otherCell"> Cell number of the other cell. </param>
+///<returns> The number of rows apart plus the number of columns apart. </returns>
+inline int MazeSolver::distance(int cell, int otherCell) const
+{
+	return std::abs(cell / m_columns - otherCell / m_columns) + std::abs(cell % m_columns - otherCell % m_columns);
+}
+
+///<summary> Adds a cell to the open list. </summary>
+///<param name="cell"> Cell number of the cell. </param>
+///<param name="cost"> Cost to reach the cell from the start. </param>
+///<param name="endCell"> Cell number of the end, to estimate the rest of the path from. </param>
+///<returns> Nothing. </returns>
+inline void MazeSolver::pushOpen(int cell, int cost, int endCell)
+{
+	m_open.push_back({ cost + MazeSolver::distance(cell, endCell), cost, cell });
+	std::push_heap(m_open.begin(), m_open.end(), MazeSolver::isLowerPriority);
+}
+
+///<summary> Takes the cell with the lowest estimate out of the open list. The open list must not be empty. </summary>
+///<returns> The open list entry of the cell. </returns>
+inline OpenEntry MazeSolver::popOpen()
+{
+	std::pop_heap(m_open.begin(), m_open.end(), MazeSolver::isLowerPriority);
+	OpenEntry entry = m_open.back();
+	m_open.pop_back();
+	return entry;
+}
+
+///<summary>
+///Orders the open list for the heap functions. Between equal estimates the cell furthest from the start comes first,
+///since it is closer to the end, which keeps A* from expanding every cell along the front of equal estimates.
+///</summary>
+///<param name="entry"> One open list entry. </param>
+///<param name="otherEntry"> The other open list entry. </param>
+///<returns> True if entry should come out of the open list after otherEntry. </returns>
+inline bool MazeSolver::isLowerPriority(const OpenEntry &entry, const OpenEntry &otherEntry)
+{
+	if (entry.estimate != otherEntry.estimate)
+	{
+		return entry.estimate > otherEntry.estimate;
+	}
+	return entry.cost < otherEntry.cost;
+}
+
+///<summary>
+///Follows the parents back from the end to the start and stores the path the right way round.
+///A parent can be a jump point several cells away in a straight line, so the cells between them are filled in.
+///</summary>
+///<param name="startCell"> Cell number of the start. </param>
+///<param name="endCell"> Cell number of the end. </param>
+///<returns> Nothing. </returns>
+void MazeSolver::buildPath(int startCell, int endCell)
+{
+	int row = endCell / m_columns;
+	int column = endCell % m_columns;
+	int cell = endCell;
+	m_path.push_back({ row, column });
+	while (cell != startCell)
+	{
+		cell = m_parent[cell];
+		int parentRow = cell / m_columns;
+		int parentColumn = cell % m_columns;
+		while (row != parentRow || column != parentColumn)
+		{
+			row += (parentRow > row) - (parentRow < row);
+			column += (parentColumn > column) - (parentColumn < column);
+			m_path.push_back({ row, column });
+		}
+	}
+	std::reverse(m_path.begin(), m_path.end());
+}
+
+#endif // !MAZESOLVER_H
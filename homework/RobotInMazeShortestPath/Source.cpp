@@ -0,0 +1,175 @@
+// Homework #2
+
+#include <iostream>
+#include <string>
+#include <chrono> // for steady_clock
+#include "MazeGrid.h"
+#include "WallBitmap.h"
+#include "MazeSolver.h"
+
+using namespace std;
+
+void createMaze(MazeGrid &maze);
+void getStartAndEndCoordinates(const WallBitmap &walls, int &startRow, int &startColumn, int &endRow, int &endColumn);
+void showPath(const MazeGrid &maze, const vector<MazeCell> &path);
+int runSearch(MazeSolver &solver, int search, int startRow, int startColumn, int endRow, int endColumn);
+
+const char PATH_CHAR = '.';
+const char *SEARCH_NAMES[] = { "", "Breadth-first", "A*", "Jump point search" };
+
+int main()
+{
+	int startRow, startColumn, endRow, endColumn, search, moves = -1;
+	char showChoice;
+	MazeGrid maze;
+
+	createMaze(maze);
+	WallBitmap walls(maze);
+	MazeSolver solver(walls);
+	getStartAndEndCoordinates(walls, startRow, startColumn, endRow, endColumn);
+	cout << "1. Breadth-first" << '\n';
+	cout << "2. A*" << '\n';
+	cout << "3. Jump point search" << '\n';
+	cout << "4. Compare all three" << '\n';
+	cout << "Which search? ";
+	cin >> search;
+	while (search < 1 || search > 4)
+	{
+		cout << "Invalid search. Please re-enter. ";
+		cin >> search;
+	}
+	// Printing a million cell maze takes far longer than solving it, so big mazes can be solved without it
+	cout << "Show the maze with the path? (y/n) ";
+	cin >> showChoice;
+
+	for (int i = 1; i <= 3; i++)
+	{
+		if (search == i || search == 4)
+		{
+			moves = runSearch(solver, i, startRow, startColumn, endRow, endColumn);
+		}
+	}
+
+	// Every search finds a shortest path, so the last one is as good as any to show
+	if (showChoice == 'y' || showChoice == 'Y')
+	{
+		showPath(maze, solver.getPath());
+	}
+	if (moves < 0)
+	{
+		cout << "There is no path from the start to the end." << endl;
+	}
+	else
+	{
+		cout << "Moves on the shortest path: " << moves << endl;
+	}
+	cout << "Cells in the maze: " << static_cast<long long>(maze.getRows()) * maze.getColumns() << endl;
+
+	return 0;
+}
+
+///<summary> Runs one search and reports how many cells it expanded and how long it took. </summary>
+///<param name="solver"> The solver for the maze. </param>
+///<param name="search"> 1 for breadth-first, 2 for A*, 3 for jump point search. </param>
+///<param name="startRow"> The start row position of the maze. </param>
+///<param name="startColumn"> The start column position of the maze. </param>
+///<param name="endRow"> The end row position of the maze. </param>
+///<param name="endColumn"> The end column position of the maze. </param>
+///<returns> Number of moves on the shortest path, or -1 if there is no path. </returns>
+int runSearch(MazeSolver &solver, int search, int startRow, int startColumn, int endRow, int endColumn)
+{
+	int moves;
+	auto startTime = chrono::steady_clock::now();
+	switch (search)
+	{
+	case 1:
+		moves = solver.solveBreadthFirst(startRow, startColumn, endRow, endColumn);
+		break;
+	case 2:
+		moves = solver.solveAStar(startRow, startColumn, endRow, endColumn);
+		break;
+	default:
+		moves = solver.solveJumpPoint(startRow, startColumn, endRow, endColumn);
+		break;
+	}
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+
+	cout << SEARCH_NAMES[search] << ": " << solver.getNumExpanded() << " cells expanded, " << elapsed.count() * 1000 << " ms" << endl;
+	return moves;
+}
+
+///<summary> Prompts user for file name (e.g., myFile.txt) then loads the maze from it. The size of the maze comes from the file. </summary>
+///<param name="maze"> The maze to load into. </param>
+///<returns> Nothing. Maze returned in output parameter. </returns>
+void createMaze(MazeGrid &maze)
+{
+	string mazePath;
+
+	cout << "Enter your file name that stores the maze (including .txt): ";
+	getline(cin, mazePath);
+
+	if (!maze.load(mazePath))
+	{
+		cout << "Error opening file." << endl;
+	}
+
+	return;
+}
+
+///<summary> Prompts user for the start row/column and end row/column for the maze. </summary>
+///<param name="walls"> The maze's walls. </param>
+///<param name="startRow"> The start row position of the maze. </param>
+///<param name="startColumn"> The start column position of the maze. </param>
+///<param name="endRow"> The end row position of the maze. </param>
+///<param name="endColumn"> The end column position of the maze. </param>
+///<returns> Nothing </returns>
+void getStartAndEndCoordinates(const WallBitmap &walls, int &startRow, int &startColumn, int &endRow, int &endColumn)
+{
+	bool valid = false;
+
+	while (!valid)
+	{
+		cout << "What is the starting row for the robot? ";
+		cin >> startRow;
+		cout << "What is the starting column for the robot? ";
+		cin >> startColumn;
+		valid = walls.isInside(startRow, startColumn) && walls.isOpen(startRow, startColumn);
+		if (!valid)
+		{
+			cout << "Invalid input" << endl;
+		}
+	}
+
+	valid = false;
+	while (!valid)
+	{
+		cout << "What is the ending row for the robot? ";
+		cin >> endRow;
+		cout << "What is the ending column for the robot? ";
+		cin >> endColumn;
+		valid = walls.isInside(endRow, endColumn) && walls.isOpen(endRow, endColumn);
+		if (!valid)
+		{
+			cout << "Invalid input" << endl;
+		}
+	}
+}
+
+///<summary> Displays the maze with every cell on the path marked. </summary>
+///<param name="maze"> The maze. </param>
+///<param name="path"> The cells on the path. </param>
+///<returns> Nothing. </returns>
+void showPath(const MazeGrid &maze, const vector<MazeCell> &path)
+{
+	MazeGrid marked = maze;
+	for (const MazeCell &cell : path)
+	{
+		marked.set(cell.row, cell.column, PATH_CHAR);
+	}
+	for (int i = 0; i < marked.getRows(); i++)
+	{
+		cout.write(marked.getRow(i), marked.getColumns());
+		cout << '\n';
+	}
+	cout.flush();
+}
@@ -0,0 +1,131 @@
+#ifndef WALLBITMAP_H
+#define WALLBITMAP_H
+#include <vector>
+#include <cstdint>
+#include "MazeGrid.h"
+
+///<summary>
+///Open cells of a maze packed one bit per cell, eight times smaller than the MazeGrid it is built from.
+///The maze is surrounded by a border of wall cells one cell wide, so any cell next to a maze cell can be read without
+///checking bounds first: a move off the edge of the maze simply finds a wall.
+///Each row, border included, is stored as whole 64 bit words. Bit (column + 1) of a row is the cell in that column, bit 0 is the left border.
+///</summary>
+class WallBitmap
+{
+public:
+	// Bits of the mask returned by openNeighbors()
+	static const int UP = 0;
+	static const int RIGHT = 1;
+	static const int DOWN = 2;
+	static const int LEFT = 3;
+
+	WallBitmap();
+	WallBitmap(const MazeGrid &maze);
+	~WallBitmap();
+	int getRows() const;
+	int getColumns() const;
+	bool isInside(int row, int column) const;
+	bool isOpen(int row, int column) const;
+	int openNeighbors(int row, int column) const;
+
+private:
+	int m_rows;
+	int m_columns;
+	int m_wordsPerRow;	// Words in each row, enough for the columns and the border column on each side
+	std::vector<uint64_t> m_bits;
+
+	size_t bitIndex(int row, int column) const;
+};
+
+///<summary> Constructor for an empty WallBitmap with no rows or columns. </summary>
+///<returns> Nothing. </returns>
+inline WallBitmap::WallBitmap()
+{
+	m_rows = 0;
+	m_columns = 0;
+	m_wordsPerRow = 0;
+}
+
+///<summary> Constructor for a WallBitmap of a maze. Every cell that is not a wall is open. </summary>
+///<param name="maze"> The maze to pack. </param>
+///<returns> Nothing. </returns>
+WallBitmap::WallBitmap(const MazeGrid &maze)
+{
+	m_rows = maze.getRows();
+	m_columns = maze.getColumns();
+	// The border column on each side takes a bit too
+	m_wordsPerRow = (m_columns + 2 + 63) / 64;
+	m_bits.assign(static_cast<size_t>(m_rows + 2) * m_wordsPerRow, 0);
+	for (int row = 0; row < m_rows; row++)
+	{
+		const char *cells = maze.getRow(row);
+		for (int column = 0; column < m_columns; column++)
+		{
+			size_t index = WallBitmap::bitIndex(row, column);
+			m_bits[index >> 6] |= static_cast<uint64_t>(cells[column] != MazeGrid::WALL_CHAR) << (index & 63);
+		}
+	}
+}
+
+///<summary> Default destructor for WallBitmap class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+inline WallBitmap::~WallBitmap()
+{
+}
+
+///<summary> Getter for the number of rows in the maze, not counting the border. </summary>
+///<returns> Number of rows. </returns>
+inline int WallBitmap::getRows() const
+{
+	return m_rows;
+}
+
+///<summary> Getter for the number of columns in the maze, not counting the border. </summary>
+///<returns> Number of columns. </returns>
+inline int WallBitmap::getColumns() const
+{
+	return m_columns;
+}
+
+///<summary> Determines whether a position is on the maze. Only needed for positions that may be more than one cell off it. </summary>
+///<param name="row"> Row of the position. </param>
+///<param name="column"> Column of the position. </param>
+///<returns> True if the position is inside the maze, otherwise false. </returns>
+inline bool WallBitmap::isInside(int row, int column) const
+{
+	// Casting to unsigned turns a negative value into a huge one, so each range is checked with a single compare
+	return static_cast<unsigned int>(row) < static_cast<unsigned int>(m_rows) && static_cast<unsigned int>(column) < static_cast<unsigned int>(m_columns);
+}
+
+///<summary> Determines whether a cell is open. The cell can be on the maze or in the border around it, but no further out. </summary>
+///<param name="row"> Row of the cell, -1 to getRows(). </param>
+///<param name="column"> Column of the cell, -1 to getColumns(). </param>
+///<returns> True if the cell is open, false if it is a wall or in the border. </returns>
+inline bool WallBitmap::isOpen(int row, int column) const
+{
+	size_t index = WallBitmap::bitIndex(row, column);
+	return (m_bits[index >> 6] >> (index & 63)) & 1;
+}
+
+///<summary> Finds which of the four cells next to a cell are open, without a branch or a bounds check. </summary>
+///<param name="row"> Row of the cell. Must be on the maze. </param>
+///<param name="column"> Column of the cell. Must be on the maze. </param>
+///<returns> Mask with bit UP, RIGHT, DOWN, or LEFT set when the cell in that direction is open. </returns>
+inline int WallBitmap::openNeighbors(int row, int column) const
+{
+	return (static_cast<int>(WallBitmap::isOpen(row - 1, column)) << UP)
+		| (static_cast<int>(WallBitmap::isOpen(row, column + 1)) << RIGHT)
+		| (static_cast<int>(WallBitmap::isOpen(row + 1, column)) << DOWN)
+		| (static_cast<int>(WallBitmap::isOpen(row, column - 1)) << LEFT);
+}
+
+///<summary> Finds the bit of a cell, counting the border. </summary>
+///<param name="row"> Row of the cell, -1 to getRows(). </param>
+///<param name="column"> Column of the cell, -1 to getColumns(). </param>
+///<returns> Index of the cell's bit in m_bits. </returns>
+inline size_t WallBitmap::bitIndex(int row, int column) const
+{
+	return static_cast<size_t>(row + 1) * m_wordsPerRow * 64 + (column + 1);
+}
+
+#endif // !WALLBITMAP_H
@@ -8,36 +8,36 @@
 #include <cstdlib> // for rand()
 #include <algorithm> // for remove()
 #include <vector> // for begin() and end()
+#include "MazeGrid.h"
+#include "WallBitmap.h"
 
 using namespace std;
 
-const int MAX_SIZE = 10;
-const char MAZE_CHAR = '*';
-
-void createMaze(char mazeArray[][MAX_SIZE]);
-void getStartAndEndCoordinates(char mazeArray[][MAX_SIZE], int &startRow, int &startColumn, int &endRow, int &endColumn);
-void showMaze(char maze[][MAX_SIZE], int robotCol, int robotRow, char direction);
-void robot(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextColumn, int &nextRow, char &direction);
-bool isValidMove(char maze[][MAX_SIZE], int column, int row);
-void wallFollow(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextColumn, int &nextRow, int numChoices, char choicesArray[4], char &direction);
+void createMaze(MazeGrid &maze);
+void getStartAndEndCoordinates(const WallBitmap &walls, int &startRow, int &startColumn, int &endRow, int &endColumn);
+void showMaze(const MazeGrid &maze, int robotCol, int robotRow, char direction);
+void robot(const WallBitmap &walls, int lastColumn, int lastRow, int &nextColumn, int &nextRow, char &direction);
+bool isValidMove(const WallBitmap &walls, int column, int row);
+void wallFollow(const WallBitmap &walls, int lastColumn, int lastRow, int &nextColumn, int &nextRow, int numChoices, char choicesArray[4], char &direction);
 char pointRobot(char currentDirection, char relativeDirection);
 
 int main()
 {
 	int startRow, startColumn, endRow, endColumn, lastColumn, lastRow, nextColumn, nextRow, moves = 0;
-	char maze[MAX_SIZE][MAX_SIZE];
+	MazeGrid maze;
 	char direction = NULL;
 	bool done = false;
 
 	createMaze(maze);
-	getStartAndEndCoordinates(maze, startRow, startColumn, endRow, endColumn);
+	WallBitmap walls(maze);
+	getStartAndEndCoordinates(walls, startRow, startColumn, endRow, endColumn);
 	showMaze(maze, startColumn, startRow, direction);
 	lastColumn = startColumn;
 	lastRow = startRow;
 
 	do
 	{
-		robot(maze, lastColumn, lastRow, nextColumn, nextRow, direction);
+		robot(walls, lastColumn, lastRow, nextColumn, nextRow, direction);
 		// pause half second and clear the screen
 		Sleep(500);
 		system("cls");
@@ -58,50 +58,32 @@ int main()
 	return 0;
 }
 
-///<summary> Prompts user for file name (e.g., myFile.txt) then stores maze into an array. Note that MAX_SIZE determines the dimensions of the maze and is a global variable. </summary>
-///<param name="mazeArray"> An array storing the maze. </param>
-///<returns> Nothing. 2D array returned in output parameter. </returns>
-void createMaze(char mazeArray[][MAX_SIZE])
+///<summary> Prompts user for file name (e.g., myFile.txt) then loads the maze from it. The size of the maze comes from the file. </summary>
+///<param name="maze"> The maze to load into. </param>
+///<returns> Nothing. Maze returned in output parameter. </returns>
+void createMaze(MazeGrid &maze)
 {
 	string mazePath;
-	ifstream mazeFile;
 
 	cout << "Enter your file name that stores the maze (including .txt): ";
 	getline(cin, mazePath);
 
-	mazeFile.open(mazePath);
-
-	if (!mazeFile)
+	if (!maze.load(mazePath))
 	{
 		cout << "Error opening file." << endl;
 	}
-	else
-	{
-		for (int i = 0; i < MAX_SIZE; i++)
-		{
-			string oneLine;
-			// Get each line and iterate over it to store in array
-			getline(mazeFile, oneLine);
-			for (int j = 0; j < MAX_SIZE; j++)
-			{
-				mazeArray[i][j] = oneLine[j];
-			}
-		}
-	}
-
-	mazeFile.close();
 
 	return;
 }
 
 ///<summary> Prompts user for the start row/column and end row/column for the maze. </summary>
-///<param name="maze"> An array storing the maze. </param>
+///<param name="walls"> The maze's walls. </param>
 ///<param name="startRow"> The start row position of the maze. </param>
 ///<param name="startColumn"> The start column position of the maze. </param>
 ///<param name="endRow"> The end row position of the maze. </param>
 ///<param name="endColumn"> The end column position of the maze. </param>
 ///<returns> Nothing </returns>
-void getStartAndEndCoordinates(char maze[][MAX_SIZE], int &startRow, int &startColumn, int &endRow, int &endColumn)
+void getStartAndEndCoordinates(const WallBitmap &walls, int &startRow, int &startColumn, int &endRow, int &endColumn)
 {
 	bool valid = false;
 
@@ -111,7 +93,8 @@ void getStartAndEndCoordinates(char maze[][MAX_SIZE], int &startRow, int &startC
 		cin >> startRow;
 		cout << "What is the starting column for the robot? ";
 		cin >> startColumn;
-		valid = isValidMove(maze, startColumn, startRow);
+		// Typed in positions can be anywhere, so they are checked against the size of the maze before the walls
+		valid = walls.isInside(startRow, startColumn) && isValidMove(walls, startColumn, startRow);
 		if (!valid)
 		{
 			cout << "Invalid input" << endl;
@@ -125,7 +108,7 @@ void getStartAndEndCoordinates(char maze[][MAX_SIZE], int &startRow, int &startC
 		cin >> endRow;
 		cout << "What is the ending column for the robot? ";
 		cin >> endColumn;
-		valid = isValidMove(maze, endColumn, endRow);
+		valid = walls.isInside(endRow, endColumn) && isValidMove(walls, endColumn, endRow);
 		if (!valid)
 		{
 			cout << "Invalid input" << endl;
@@ -133,17 +116,24 @@ void getStartAndEndCoordinates(char maze[][MAX_SIZE], int &startRow, int &startC
 	}
 }
 
-///<summary> Displays the 10 by 10 maze given to it to the console. </summary>
-///<param name="maze"> A 10 by 10 array. </param>
+///<summary> Displays the maze given to it to the console. </summary>
+///<param name="maze"> The maze. </param>
 ///<param name="robotCol"> The current column the robot is in. </param>
 ///<param name="robotRow"> The current row the robot is in. </param>
 ///<param name="direction"> The direction the robot is facing. 'u' - Up, 'd' - down, 'l' - left, 'r' - right </param>
 ///<returns> Nothing. </returns>
-void showMaze(char maze[][MAX_SIZE], int robotCol, int robotRow, char direction)
+void showMaze(const MazeGrid &maze, int robotCol, int robotRow, char direction)
 {
-	for (int i = 0; i < MAX_SIZE; i++)
+	for (int i = 0; i < maze.getRows(); i++)
 	{
-		for (int j = 0; j < MAX_SIZE; j++)
+		// Rows are contiguous, so each is written in one go apart from the robot
+		if (i != robotRow)
+		{
+			cout.write(maze.getRow(i), maze.getColumns());
+			cout << '\n';
+			continue;
+		}
+		for (int j = 0; j < maze.getColumns(); j++)
 		{
 			if (i == robotRow && j == robotCol)
 			{
@@ -168,22 +158,23 @@ void showMaze(char maze[][MAX_SIZE], int robotCol, int robotRow, char direction)
 			}
 			else
 			{
-				cout << maze[i][j];
+				cout << maze.get(i, j);
 			}
 		}
-		cout << endl;
+		cout << '\n';
 	}
+	cout.flush();
 }
 
 ///<summary> Controls the movement of the robot in the maze. </summary>
-///<param name="maze"> A 10 by 10 array. </param>
+///<param name="walls"> The maze's walls. </param>
 ///<param name="lastColumn"> Robot's last column position </param>
 ///<param name="lastRow"> Robot's last row position </param>
 ///<param name="nextColumn"> Robot's next column position </param>
 ///<param name="nextRow"> Robot's next row position </param>
 ///<param name="direction"> Robot's current direction </param>
 ///<returns> Nothing. </returns>
-void robot(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextColumn, int &nextRow, char &direction)
+void robot(const WallBitmap &walls, int lastColumn, int lastRow, int &nextColumn, int &nextRow, char &direction)
 {
 	int max = 4;
 	bool validMove = false;
@@ -224,7 +215,7 @@ void robot(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextColumn,
 				break;
 			}
 
-			if (isValidMove(maze, tempColumn, tempRow))
+			if (isValidMove(walls, tempColumn, tempRow))
 			{
 				nextColumn = tempColumn;
 				nextRow = tempRow;
@@ -239,7 +230,7 @@ void robot(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextColumn,
 		}
 		else
 		{
-			wallFollow(maze, lastColumn, lastRow, tempColumn, tempRow, max, directions, direction);
+			wallFollow(walls, lastColumn, lastRow, tempColumn, tempRow, max, directions, direction);
 			nextColumn = tempColumn;
 			nextRow = tempRow;
 			validMove = true; // wallFollow() checks to see that its moves are valid
@@ -250,29 +241,17 @@ void robot(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextColumn,
 	}
 }
 
-///<summary> Determines whether the position the robot would move to is valid or not. </summary>
-///<param name="maze"> A 10 by 10 array containing the maze </param>
-///<param name="column"> Current column position of the robot </param>
-///<param name="row"> Current row position of the robot </param>
+///<summary>
+///Determines whether the position the robot would move to is valid or not.
+///The maze is bordered by walls in the bitmap, so a single bit test covers both walls and moves off the maze.
+///</summary>
+///<param name="walls"> The maze's walls </param>
+///<param name="column"> Column the robot would move to, at most one off the maze </param>
+///<param name="row"> Row the robot would move to, at most one off the maze </param>
 ///<returns> If the robot would move into a wall or off the maze return false, otherwise true. </returns>
-bool isValidMove(char maze[][MAX_SIZE], int column, int row)
+bool isValidMove(const WallBitmap &walls, int column, int row)
 {
-	if (maze[row][column] == MAZE_CHAR)
-	{
-		return false;
-	}
-	else if (column < 0 || column > MAX_SIZE - 1)
-	{
-		return false;
-	}
-	else if (row < 0 || row > MAX_SIZE - 1)
-	{
-		return false;
-	}
-	else
-	{
-		return true;
-	}
+	return walls.isOpen(row, column);
 }
 
 ///<summary> Right wall follow algorithm:
@@ -282,7 +261,7 @@ bool isValidMove(char maze[][MAX_SIZE], int column, int row)
 ///4. If the robot cannot go forward or right then go left
 ///5. If the robot cannot go forward, right, or left then go back
 ///</summary>
-///<param name="maze"> 2D array that stores the maze. </param>
+///<param name="walls"> The maze's walls. </param>
 ///<param name="lastColumn"> Robot's last column position </param>
 ///<param name="lastRow"> Robot's last row position </param>
 ///<param name="nextColumn"> Robot's next column position </param>
@@ -291,9 +270,9 @@ bool isValidMove(char maze[][MAX_SIZE], int column, int row)
 ///<param name="choicesArray"> Array of choices ('u', 'd', 'l', 'r') </param>
 ///<param name="direction"> The current direction of the robot</param>
 ///<returns> Returns the new direction of the robot. 'u' - Up, 'd' - Down, 'l' - Left, 'r' - Right</returns>
-void wallFollow(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextColumn, int &nextRow, int numChoices, char choicesArray[4],  char &direction)
+void wallFollow(const WallBitmap &walls, int lastColumn, int lastRow, int &nextColumn, int &nextRow, int numChoices, char choicesArray[4],  char &direction)
 {
-	int randomNumber, colRight, rowRight, colForward, rowForward, colLeft, rowLeft, colBack, rowBack;
+	int randomNumber, colRight, rowRight, colForward, rowForward, colLeft, rowLeft, colBack, rowBack, forwardBit = WallBitmap::UP;
 	char back;
 
 	// Checking just in case
@@ -318,6 +297,7 @@ void wallFollow(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextCol
 		colBack = lastColumn;
 		rowBack = lastRow + 1;
 		back = 'd';
+		forwardBit = WallBitmap::UP;
 		break;
 	case 'd':
 		colRight = lastColumn - 1;
@@ -329,6 +309,7 @@ void wallFollow(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextCol
 		colBack = lastColumn;
 		rowBack = lastRow - 1;
 		back = 'u';
+		forwardBit = WallBitmap::DOWN;
 		break;
 	case 'l':
 		colRight = lastColumn;
@@ -340,6 +321,7 @@ void wallFollow(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextCol
 		colBack = lastColumn + 1;
 		rowBack = lastRow;
 		back = 'r';
+		forwardBit = WallBitmap::LEFT;
 		break;
 	case 'r':
 		colRight = lastColumn;
@@ -351,12 +333,19 @@ void wallFollow(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextCol
 		colBack = lastColumn - 1;
 		rowBack = lastRow;
 		back = 'l';
+		forwardBit = WallBitmap::RIGHT;
 		break;
 	default:
 		break;
 	}
 
-	if (maze[rowRight][colRight] == MAZE_CHAR && isValidMove(maze, colForward, rowForward))
+	// One look at the bitmap gives all four neighbors. The directions go clockwise, so right and left are one step either side of forward
+	int openNeighbors = walls.openNeighbors(lastRow, lastColumn);
+	bool isForwardOpen = (openNeighbors >> forwardBit) & 1;
+	bool isRightOpen = (openNeighbors >> ((forwardBit + 1) % 4)) & 1;
+	bool isLeftOpen = (openNeighbors >> ((forwardBit + 3) % 4)) & 1;
+
+	if (!isRightOpen && isForwardOpen)
 	{
 		// Keep going forward in the same direction
 		direction = direction;
@@ -364,13 +353,13 @@ void wallFollow(char maze[][MAX_SIZE], int lastColumn, int lastRow, int &nextCol
 		nextRow = rowForward;
 	}
 	// Don't try to turn right if ahead of the robot is off the map, since then the robot can just go into a circle infinitely
-	else if (maze[rowRight][colRight] == ' ' && (rowForward >= 0 && rowForward <= MAX_SIZE - 1) && (colForward >= 0 && colForward <= MAX_SIZE - 1) && isValidMove(maze, colRight, rowRight))
+	else if (isRightOpen && walls.isInside(rowForward, colForward))
 	{
 		direction = pointRobot(direction, 'r');
 		nextColumn = colRight;
 		nextRow = rowRight;
 	}
-	else if (isValidMove(maze, colLeft, rowLeft))
+	else if (isLeftOpen)
 	{
 		direction = pointRobot(direction, 'l');
 		nextColumn = colLeft;
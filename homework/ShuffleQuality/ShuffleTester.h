@@ -0,0 +1,352 @@
+#ifndef SHUFFLETESTER_H
+#define SHUFFLETESTER_H
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <chrono>
+#include <functional>
+#include <algorithm> // for std::max()
+#include <cmath>
+#include <cstdint>
+#include <cstring> // for memcpy()
+#include "RandomGenerator.h"
+
+///<summary>
+///What one thread counted while testing a shuffle. Threads keep their own counts so they never share a counter.
+///Cards are numbered 0 to deckSize - 1 in their order before the shuffle.
+///</summary>
+struct ShuffleCounts
+{
+	std::vector<long long> positionCounts;		// [card * deckSize + position], how often each card ended up at each position
+	std::vector<long long> adjacencyCounts;		// [card * deckSize + nextCard], how often card was directly followed by nextCard
+	std::vector<long long> permutationCounts;	// [rank], how often the first few cards came out in each relative order
+};
+
+///<summary> Results of testing one shuffle. The z scores are near 0 for a fair shuffle and large and positive for a biased one. </summary>
+struct ShuffleResult
+{
+	std::string name;
+	long long numShuffles;
+	double seconds;
+	double positionChiSquare;
+	int positionDegrees;
+	double positionZ;
+	double maxPositionBias;			// Largest relative difference between any card and position count and the expected count
+	double adjacencyChiSquare;
+	int adjacencyDegrees;
+	double adjacencyZ;
+	double keptNeighborRatio;		// Cards still directly followed by the card after them before the shuffle, over the expected number
+	double permutationChiSquare;
+	int permutationDegrees;
+	double permutationZ;
+};
+
+///<summary>
+///Statistical test harness for shuffles. Runs a large number of shuffles of a deck of any size spread over every core,
+///then measures three things a fair shuffle gets right:
+///Position bias - every card is equally likely to end up at every position (chi-square over the card by position table).
+///Adjacency - every card is equally likely to be followed by every other card (chi-square over the card by next card table).
+///Permutations - the first PERMUTATION_CARDS cards come out in every relative order equally often (chi-square over the orders).
+///Each chi-square is turned into a z score with the Wilson-Hilferty approximation, and a shuffle with any z score above
+///BIASED_Z is reported as biased.
+///</summary>
+class ShuffleTester
+{
+public:
+	static const int MAX_DECK_SIZE = 52;
+	static const int PERMUTATION_CARDS = 5;
+	static constexpr double BIASED_Z = 4.0;
+
+	ShuffleTester(int deckSize);
+	~ShuffleTester();
+	void setNumThreads(int numThreads);
+	void addShuffle(std::string name, std::function<void(uint8_t *cards, int numCards, RandomGenerator &generator)> shuffle);
+	void run(long long numShuffles, unsigned int seed);
+	std::vector<ShuffleResult> getResults();
+	void display();
+
+private:
+	int m_deckSize;
+	int m_numThreads;
+	int m_permutationCards;
+	int m_numPermutations;
+	std::vector<std::string> m_names;
+	std::vector<std::function<void(uint8_t *cards, int numCards, RandomGenerator &generator)>> m_shuffles;
+	std::vector<ShuffleResult> m_results;
+
+	void countShuffles(int shuffleIndex, long long numShuffles, uint64_t seed, ShuffleCounts &counts);
+	ShuffleResult score(int shuffleIndex, long long numShuffles, const ShuffleCounts &counts);
+	int rankOrder(const uint8_t *cards);
+	static double zScore(double chiSquare, int degrees);
+	static uint64_t mixSeed(unsigned int seed, int shuffleIndex, int thread);
+};
+
+///<summary> Constructor for a ShuffleTester with no shuffles. Uses one thread per hardware thread. </summary>
+///<param name="deckSize"> Number of cards in the deck shuffled, 2 to MAX_DECK_SIZE. </param>
+///<returns> Nothing. </returns>
+ShuffleTester::ShuffleTester(int deckSize)
+{
+	m_deckSize = std::max(2, std::min(deckSize, MAX_DECK_SIZE));
+	m_numThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+	m_permutationCards = std::min(m_deckSize, PERMUTATION_CARDS);
+	m_numPermutations = 1;
+	for (int i = 2; i <= m_permutationCards; i++)
+	{
+		m_numPermutations *= i;
+	}
+}
+
+///<summary> Default destructor for ShuffleTester class. No special actions taken. </summary>
+///<returns> Nothing. </returns>
+ShuffleTester::~ShuffleTester()
+{
+}
+
+///<summary> Setter for the number of threads the shuffles are spread over. </summary>
+///<param name="numThreads"> Number of threads. </param>
+///<returns> Nothing. </returns>
+inline void ShuffleTester::setNumThreads(int numThreads)
+{
+	m_numThreads = std::max(1, numThreads);
+}
+
+///<summary> Adds a shuffle to test. </summary>
+///<param name="name"> Name to report the shuffle under. </param>
+///<param name="shuffle"> Shuffles an array of cards in place, drawing from the generator it is given. Called from many threads at once. </param>
+///<returns> Nothing. </returns>
+void ShuffleTester::addShuffle(std::string name, std::function<void(uint8_t *cards, int numCards, RandomGenerator &generator)> shuffle)
+{
+	m_names.push_back(name);
+	m_shuffles.push_back(shuffle);
+}
+
+///<summary>
+///Tests every shuffle added. For each shuffle the work is split evenly between the threads, each with its own generator
+///and counts, and the counts are added together once every thread has finished.
+///</summary>
+///<param name="numShuffles"> Number of shuffles to run for each shuffle being tested. </param>
+///<param name="seed"> Seed for the whole run. The same seed gives the same results. </param>
+///<returns> Nothing. </returns>
+void ShuffleTester::run(long long numShuffles, unsigned int seed)
+{
+	m_results.clear();
+	for (size_t s = 0; s < m_shuffles.size(); s++)
+	{
+		std::vector<ShuffleCounts> threadCounts(m_numThreads);
+		std::vector<std::thread> threads;
+		auto startTime = std::chrono::steady_clock::now();
+		for (int t = 0; t < m_numThreads; t++)
+		{
+			long long threadShuffles = numShuffles / m_numThreads + (t < numShuffles % m_numThreads ? 1 : 0);
+			threads.push_back(std::thread(&ShuffleTester::countShuffles, this, s, threadShuffles, mixSeed(seed, s, t), std::ref(threadCounts.at(t))));
+		}
+		for (std::thread &thread : threads)
+		{
+			thread.join();
+		}
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - startTime;
+
+		ShuffleCounts &total = threadCounts.at(0);
+		for (int t = 1; t < m_numThreads; t++)
+		{
+			for (size_t i = 0; i < total.positionCounts.size(); i++)
+			{
+				total.positionCounts.at(i) += threadCounts.at(t).positionCounts.at(i);
+				total.adjacencyCounts.at(i) += threadCounts.at(t).adjacencyCounts.at(i);
+			}
+			for (size_t i = 0; i < total.permutationCounts.size(); i++)
+			{
+				total.permutationCounts.at(i) += threadCounts.at(t).permutationCounts.at(i);
+			}
+		}
+		ShuffleResult result = ShuffleTester::score(s, numShuffles, total);
+		result.seconds = elapsed.count();
+		m_results.push_back(result);
+	}
+}
+
+///<summary> Getter for the results of the last run. </summary>
+///<returns> One ShuffleResult for each shuffle, in the order they were added. </returns>
+inline std::vector<ShuffleResult> ShuffleTester::getResults()
+{
+	return m_results;
+}
+
+///<summary> Displays the results of the last run on the console. </summary>
+///<returns> Nothing. </returns>
+void ShuffleTester::display()
+{
+	std::cout << m_deckSize << " card deck, z scores above " << BIASED_Z << " are reported as biased" << '\n';
+	std::cout << std::left << std::setw(22) << "Shuffle" << std::setw(14) << "Shuffles/s" << std::setw(12) << "Position z"
+		<< std::setw(12) << "Max bias" << std::setw(13) << "Adjacency z" << std::setw(10) << "Kept" << std::setw(15) << "Permutation z"
+		<< "Result" << '\n';
+	for (ShuffleResult &result : m_results)
+	{
+		bool isBiased = result.positionZ > BIASED_Z || result.adjacencyZ > BIASED_Z || result.permutationZ > BIASED_Z;
+		std::cout << std::left << std::setw(22) << result.name << std::setw(14) << std::setprecision(4) << result.numShuffles / result.seconds
+			<< std::setw(12) << result.positionZ << std::setw(12) << result.maxPositionBias << std::setw(13) << result.adjacencyZ
+			<< std::setw(10) << result.keptNeighborRatio << std::setw(15) << result.permutationZ << (isBiased ? "biased" : "ok") << '\n';
+	}
+}
+
+///<summary> Runs one thread's share of the shuffles and counts where every card ended up. </summary>
+///<param name="shuffleIndex"> Index of the shuffle being tested. </param>
+///<param name="numShuffles"> Number of shuffles to run. </param>
+///<param name="seed"> Seed for the thread's generator. </param>
+///<param name="counts"> The thread's counts. Sized and zeroed here. </param>
+///<returns> Nothing. </returns>
+void ShuffleTester::countShuffles(int shuffleIndex, long long numShuffles, uint64_t seed, ShuffleCounts &counts)
+{
+	std::function<void(uint8_t *cards, int numCards, RandomGenerator &generator)> &shuffle = m_shuffles.at(shuffleIndex);
+	RandomGenerator generator(seed);
+	uint8_t ordered[MAX_DECK_SIZE];
+	uint8_t cards[MAX_DECK_SIZE];
+	int n = m_deckSize;
+	// Raw pointers keep bounds checks out of the counting loops, which run for every card of every shuffle
+	counts.positionCounts.assign(n * n, 0);
+	counts.adjacencyCounts.assign(n * n, 0);
+	counts.permutationCounts.assign(m_numPermutations, 0);
+	long long *positionCounts = counts.positionCounts.data();
+	long long *adjacencyCounts = counts.adjacencyCounts.data();
+	long long *permutationCounts = counts.permutationCounts.data();
+	for (int i = 0; i < n; i++)
+	{
+		ordered[i] = static_cast<uint8_t>(i);
+	}
+
+	for (long long s = 0; s < numShuffles; s++)
+	{
+		std::memcpy(cards, ordered, n);
+		shuffle(cards, n, generator);
+		for (int p = 0; p < n; p++)
+		{
+			positionCounts[cards[p] * n + p]++;
+		}
+		for (int p = 0; p < n - 1; p++)
+		{
+			adjacencyCounts[cards[p] * n + cards[p + 1]]++;
+		}
+		permutationCounts[ShuffleTester::rankOrder(cards)]++;
+	}
+}
+
+///<summary> Works out the statistics for one shuffle from its counts. </summary>
+///<param name="shuffleIndex"> Index of the shuffle being tested. </param>
+///<param name="numShuffles"> Number of shuffles counted. </param>
+///<param name="counts"> Counts from every thread added together. </param>
+///<returns> The results, without the time taken. </returns>
+ShuffleResult ShuffleTester::score(int shuffleIndex, long long numShuffles, const ShuffleCounts &counts)
+{
+	int n = m_deckSize;
+	ShuffleResult result = {};
+	result.name = m_names.at(shuffleIndex);
+	result.numShuffles = numShuffles;
+
+	// Every card lands on every position with chance 1 / n. Each row and column adds up to numShuffles, leaving (n - 1)^2 free cells.
+	// A shuffle adds a whole permutation matrix, not n independent draws, so the plain Pearson sum averages n(n - 1) for a fair
+	// shuffle instead of (n - 1)^2. Scaling it by (n - 1) / n brings it back to a chi-square with (n - 1)^2 degrees of freedom.
+	double expected = static_cast<double>(numShuffles) / n;
+	for (long long count : counts.positionCounts)
+	{
+		result.positionChiSquare += (count - expected) * (count - expected) / expected;
+		result.maxPositionBias = std::max(result.maxPositionBias, std::fabs(count / expected - 1.0));
+	}
+	result.positionChiSquare *= static_cast<double>(n - 1) / n;
+	result.positionDegrees = (n - 1) * (n - 1);
+	result.positionZ = ShuffleTester::zScore(result.positionChiSquare, result.positionDegrees);
+
+	// There are n - 1 neighbouring pairs in each shuffle, spread over the n * (n - 1) ordered pairs of different cards
+	long long keptNeighbors = 0;
+	for (int card = 0; card < n; card++)
+	{
+		for (int nextCard = 0; nextCard < n; nextCard++)
+		{
+			if (card != nextCard)
+			{
+				long long count = counts.adjacencyCounts.at(card * n + nextCard);
+				result.adjacencyChiSquare += (count - expected) * (count - expected) / expected;
+			}
+		}
+		if (card < n - 1)
+		{
+			keptNeighbors += counts.adjacencyCounts.at(card * n + card + 1);
+		}
+	}
+	result.adjacencyDegrees = n * (n - 1) - 1;
+	result.adjacencyZ = ShuffleTester::zScore(result.adjacencyChiSquare, result.adjacencyDegrees);
+	result.keptNeighborRatio = keptNeighbors / (expected * (n - 1));
+
+	double expectedOrder = static_cast<double>(numShuffles) / m_numPermutations;
+	for (long long count : counts.permutationCounts)
+	{
+		result.permutationChiSquare += (count - expectedOrder) * (count - expectedOrder) / expectedOrder;
+	}
+	result.permutationDegrees = m_numPermutations - 1;
+	result.permutationZ = ShuffleTester::zScore(result.permutationChiSquare, result.permutationDegrees);
+	return result;
+}
+
+///<summary>
+///Finds the relative order the first m_permutationCards cards (numbered 0 up) came out of the shuffle in, and numbers it
+///with its Lehmer code so every order gets its own bucket from 0 to m_numPermutations - 1.
+///</summary>
+///<param name="cards"> A shuffled deck. </param>
+///<returns> The bucket of the order. </returns>
+int ShuffleTester::rankOrder(const uint8_t *cards)
+{
+	uint8_t order[PERMUTATION_CARDS];
+	int found = 0;
+	for (int p = 0; p < m_deckSize && found < m_permutationCards; p++)
+	{
+		if (cards[p] < m_permutationCards)
+		{
+			order[found++] = cards[p];
+		}
+	}
+	int rank = 0;
+	for (int i = 0; i < m_permutationCards; i++)
+	{
+		int smallerAfter = 0;
+		for (int j = i + 1; j < m_permutationCards; j++)
+		{
+			smallerAfter += (order[j] < order[i]) ? 1 : 0;
+		}
+		rank = rank * (m_permutationCards - i) + smallerAfter;
+	}
+	return rank;
+}
+
+///<summary>
+///Turns a chi-square statistic into a z score with the Wilson-Hilferty approximation, which is close enough for the
+///large numbers of degrees of freedom used here and needs no tables.
+///</summary>
+///<param name="chiSquare"> The chi-square statistic. </param>
+///<param name="degrees"> Degrees of freedom. </param>
+///<returns> The z score. Around 0 for counts that match what was expected, large and positive when they do not. </returns>
+double ShuffleTester::zScore(double chiSquare, int degrees)
+{
+	if (degrees <= 0)
+	{
+		return 0;
+	}
+	double variance = 2.0 / (9.0 * degrees);
+	return (std::cbrt(chiSquare / degrees) - (1.0 - variance)) / std::sqrt(variance);
+}
+
+///<summary> Mixes the run's seed with a shuffle and thread number (SplitMix64 finalizer) so every thread gets an unrelated stream. </summary>
+///<param name="seed"> Seed for the whole run. </param>
+///<param name="shuffleIndex"> Index of the shuffle being tested. </param>
+///<param name="thread"> Index of the thread. </param>
+///<returns> The mixed seed. </returns>
+uint64_t ShuffleTester::mixSeed(unsigned int seed, int shuffleIndex, int thread)
+{
+	uint64_t z = (static_cast<uint64_t>(seed) << 32) ^ (static_cast<uint64_t>(shuffleIndex) << 16) ^ static_cast<uint64_t>(thread);
+	z += 0x9E3779B97F4A7C15ULL;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+#endif // !SHUFFLETESTER_H
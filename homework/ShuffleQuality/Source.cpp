@@ -0,0 +1,66 @@
+// Henry Wu
+// COMSC 165
+// Section 3015
+// Homework 5
+
+#include <iostream>
+#include <algorithm> // for std::shuffle() and std::swap()
+#include "Card.h"
+#include "Deck.h"
+#include "RandomGenerator.h"
+#include "ShuffleTester.h"
+
+using namespace std;
+
+int main()
+{
+	int deckSize, numThreads;
+	long long numShuffles;
+	unsigned int seed;
+	cout << "Shuffle Quality" << '\n';
+	cout << "How many cards in the deck? (2-52) ";
+	cin >> deckSize;
+	cout << "How many shuffles of each kind? ";
+	cin >> numShuffles;
+	cout << "Seed? ";
+	cin >> seed;
+	cout << "How many threads? (0 for one per core) ";
+	cin >> numThreads;
+
+	ShuffleTester tester(deckSize);
+	if (numThreads > 0)
+	{
+		tester.setNumThreads(numThreads);
+	}
+
+	// The shuffle the Hearts and DeckOfCards decks use. Each project keeps its own copy of Deck.h, and Deck::shuffleItems() is the same in every copy
+	tester.addShuffle("Deck::shuffle", [](uint8_t *cards, int numCards, RandomGenerator &generator)
+	{
+		Deck::shuffleItems(cards, numCards, generator);
+	});
+	// The old shuffle: every position swaps with any position, 'rand() % deckSize'. There are n^n equally likely
+	// runs but n! orders, and n^n is not a multiple of n!, so some orders come up more often than others
+	tester.addShuffle("Full range swap", [](uint8_t *cards, int numCards, RandomGenerator &generator)
+	{
+		for (int i = 0; i < numCards; i++)
+		{
+			swap(cards[i], cards[generator.next() % numCards]);
+		}
+	});
+	// Fisher-Yates with a 15 bit 'rand() % (i + 1)', like rand() where RAND_MAX is 32767. Low values are drawn slightly more often
+	tester.addShuffle("Fisher-Yates 15 bit %", [](uint8_t *cards, int numCards, RandomGenerator &generator)
+	{
+		for (int i = numCards - 1; i > 0; i--)
+		{
+			swap(cards[i], cards[(generator.next() >> 49) % (i + 1)]);
+		}
+	});
+	tester.addShuffle("std::shuffle", [](uint8_t *cards, int numCards, RandomGenerator &generator)
+	{
+		std::shuffle(cards, cards + numCards, generator);
+	});
+
+	tester.run(numShuffles, seed);
+	tester.display();
+	return 0;
+}
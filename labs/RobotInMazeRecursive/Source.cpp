@@ -1,6 +1,9 @@
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <vector>
+#include <random> // for mt19937
+#include <chrono> // for steady_clock
 #include <Windows.h> // for Sleep function
 
 using namespace std;
@@ -9,43 +12,81 @@ using namespace std;
 // ‘Exit’ is exit from maze – robot escapes from maze here
 // ‘Visited’ marks a ‘Space’ that has been visited by robot
 // ‘Escaped’ marks an ‘Exit’ that has been visited by robot
-enum Values { Space, Wall, Exit, Visited, Escaped };
-Values maze[10][10];
+// One byte per cell, so a maze of tens of millions of cells fits in tens of megabytes
+enum Values : unsigned char { Space, Wall, Exit, Visited, Escaped };
+// The maze is stored row by row, cell (i, j) is maze[i * mazeColumns + j]
+vector<Values> maze;
+int mazeRows = 0;
+int mazeColumns = 0;
 int moves = 0; // counts number of robot moves
+bool showMoves = true; // false to run without drawing the maze on every move
 			   // startRow and startColumn are initial position of robot
 void createMaze(int& startRow, int& startColumn) {
-	for (int i = 0; i < 10; i++)
-		for (int j = 0; j < 10; j++)
-			maze[i][j] = Wall;
+	mazeRows = 10;
+	mazeColumns = 10;
+	maze.assign(mazeRows * mazeColumns, Wall);
 	for (int j = 1; j < 10; j++)
-		maze[1][j] = Space;
+		maze[1 * mazeColumns + j] = Space;
 	for (int i = 1; i < 8; i++)
-		maze[i][1] = Space;
+		maze[i * mazeColumns + 1] = Space;
 	for (int j = 0; j < 5; j++)
-		maze[7][j] = Space;
+		maze[7 * mazeColumns + j] = Space;
 	for (int j = 2; j < 10; j++)
-		maze[4][j] = Space;
+		maze[4 * mazeColumns + j] = Space;
 	for (int i = 2; i < 4; i++)
-		maze[i][5] = Space;
-	maze[8][4] = Space;
-	maze[7][0] = Exit;
-	maze[4][9] = Exit;
+		maze[i * mazeColumns + 5] = Space;
+	maze[8 * mazeColumns + 4] = Space;
+	maze[7 * mazeColumns + 0] = Exit;
+	maze[4 * mazeColumns + 9] = Exit;
 	startRow = 1;
 	startColumn = 9;
 	return;
 }
 
+// Fills a maze of any size with random walls, about one cell in three. Open cells on the edge are exits.
+// The robot starts in the middle.
+void createRandomMaze(int rows, int columns, unsigned int seed, int& startRow, int& startColumn)
+{
+	mt19937 generator(seed);
+	mazeRows = rows;
+	mazeColumns = columns;
+	maze.assign(static_cast<size_t>(rows) * columns, Space);
+	for (size_t k = 0; k < maze.size(); k++)
+	{
+		if (generator() % 3 == 0)
+		{
+			maze[k] = Wall;
+		}
+	}
+	for (int i = 0; i < rows; i++)
+	{
+		for (int j = 0; j < columns; j++)
+		{
+			size_t k = static_cast<size_t>(i) * columns + j;
+			if ((i == 0 || i == rows - 1 || j == 0 || j == columns - 1) && maze[k] == Space)
+			{
+				maze[k] = Exit;
+			}
+		}
+	}
+	startRow = rows / 2;
+	startColumn = columns / 2;
+	maze[static_cast<size_t>(startRow) * columns + startColumn] = Space;
+}
+
 void showMaze(int robotRow, int robotColumn) {
+	if (!showMoves)
+		return;
 	Sleep(500);
 	system("cls");
 
 	//Clear screen here – specific command depends on environment
-	for (int i = 0; i < 10; i++) {
-		for (int j = 0; j < 10; j++)
+	for (int i = 0; i < mazeRows; i++) {
+		for (int j = 0; j < mazeColumns; j++)
 			if (i == robotRow && j == robotColumn)
 				cout << 'X';
 			else
-				switch (maze[i][j]) {
+				switch (maze[static_cast<size_t>(i) * mazeColumns + j]) {
 				case Space:
 					cout << ' ';
 					break;
@@ -68,26 +109,39 @@ void showMaze(int robotRow, int robotColumn) {
 	cout << endl << moves << " moves" << endl;
 	return;
 }
+
+// The robot can move onto a cell that is on the maze and has not been visited yet
+bool canMove(int i, int j)
+{
+	if (i < 0 || i >= mazeRows || j < 0 || j >= mazeColumns)
+	{
+		return false;
+	}
+	Values cell = maze[static_cast<size_t>(i) * mazeColumns + j];
+	return cell == Space || cell == Exit;
+}
+
+// Moves the robot onto a cell and marks it
+void visit(int i, int j)
+{
+	size_t k = static_cast<size_t>(i) * mazeColumns + j;
+	showMaze(i, j);
+	moves = moves + 1;
+	maze[k] = (maze[k] == Exit) ? Escaped : Visited;
+}
+
 void recursiveMove(int i, int j) {
 
 	// your code here
-	
-	if (maze[i][j] == Wall || maze[i][j] == Visited || maze[i][j] == Escaped || i < 0 || i > 9 || j < 0 || j > 9)
+
+	// Off the maze is checked first so the maze is never read outside its cells
+	if (!canMove(i, j))
 	{
 		return;
 	}
 	else
 	{
-		showMaze(i, j);
-		moves = moves + 1;
-		if (maze[i][j] == Space)
-		{
-			maze[i][j] = Visited;
-		}
-		else if (maze[i][j] == Exit)
-		{
-			maze[i][j] = Escaped;
-		}
+		visit(i, j);
 		// Order of these directions should not matter
 		recursiveMove(i + 1, j);
 		recursiveMove(i, j + 1);
@@ -97,11 +151,159 @@ void recursiveMove(int i, int j) {
 
 }
 
+// Same moves in the same order as recursiveMove(), but the cells being explored are kept on a vector instead of the
+// call stack, so a long path through a big maze cannot overflow it.
+// Only the cell is kept, not which direction it tries next: the directions it already tried are now either walls or
+// visited, so looking through all four again finds the same next move the recursion would make.
+void iterativeMove(int i, int j)
+{
+	const int rowSteps[4] = { 1, 0, 0, -1 };
+	const int columnSteps[4] = { 0, 1, -1, 0 };
+	vector<int> rows, columns;
+
+	if (!canMove(i, j))
+	{
+		return;
+	}
+	visit(i, j);
+	rows.push_back(i);
+	columns.push_back(j);
+	while (!rows.empty())
+	{
+		int row = rows.back();
+		int column = columns.back();
+		bool moved = false;
+		for (int d = 0; d < 4 && !moved; d++)
+		{
+			if (canMove(row + rowSteps[d], column + columnSteps[d]))
+			{
+				visit(row + rowSteps[d], column + columnSteps[d]);
+				rows.push_back(row + rowSteps[d]);
+				columns.push_back(column + columnSteps[d]);
+				moved = true;
+			}
+		}
+		if (!moved)
+		{
+			rows.pop_back();
+			columns.pop_back();
+		}
+	}
+}
+
+// Marks the same cells as recursiveMove(), but a whole run of open cells along a row at a time, so the maze is read in
+// order through memory instead of jumping between rows. Each run puts one cell of every open run touching it in the
+// rows above and below on a vector to fill from later. The robot's moves are not drawn, only the count is kept.
+void scanlineMove(int i, int j)
+{
+	vector<size_t> seeds;
+
+	if (!canMove(i, j))
+	{
+		return;
+	}
+	seeds.push_back(static_cast<size_t>(i) * mazeColumns + j);
+	while (!seeds.empty())
+	{
+		size_t k = seeds.back();
+		seeds.pop_back();
+		if (maze[k] != Space && maze[k] != Exit)
+		{
+			continue; // Filled by another run since it was added
+		}
+		size_t rowStart = k - k % mazeColumns;
+		size_t rowEnd = rowStart + mazeColumns;
+		size_t left = k;
+		size_t right = k + 1;
+		while (left > rowStart && (maze[left - 1] == Space || maze[left - 1] == Exit))
+		{
+			left--;
+		}
+		while (right < rowEnd && (maze[right] == Space || maze[right] == Exit))
+		{
+			right++;
+		}
+		for (size_t m = left; m < right; m++)
+		{
+			maze[m] = (maze[m] == Exit) ? Escaped : Visited;
+		}
+		moves = moves + static_cast<int>(right - left);
+
+		// Rows above and below, skipping any that are off the maze
+		for (int side = 0; side < 2; side++)
+		{
+			if ((side == 0 && rowStart == 0) || (side == 1 && rowEnd == maze.size()))
+			{
+				continue;
+			}
+			bool inRun = false;
+			for (size_t m = left; m < right; m++)
+			{
+				size_t next = (side == 0) ? m - mazeColumns : m + mazeColumns;
+				bool open = maze[next] == Space || maze[next] == Exit;
+				if (open && !inRun)
+				{
+					seeds.push_back(next);
+				}
+				inRun = open;
+			}
+		}
+	}
+}
+
 int main()
 {
-	int startRow, startColumn;
-	createMaze(startRow, startColumn);
-	recursiveMove(startRow, startColumn);
+	int startRow, startColumn, mode, rows;
+	char showChoice;
+	cout << "1. Recursive" << '\n';
+	cout << "2. Iterative" << '\n';
+	cout << "3. Scanline fill" << '\n';
+	cout << "How should the robot explore? ";
+	cin >> mode;
+	cout << "How many rows and columns? (0 for the lab maze) ";
+	cin >> rows;
+	if (rows > 0)
+	{
+		int columns;
+		unsigned int seed;
+		cin >> columns;
+		cout << "Seed? ";
+		cin >> seed;
+		createRandomMaze(rows, columns, seed, startRow, startColumn);
+	}
+	else
+	{
+		createMaze(startRow, startColumn);
+	}
+	cout << "Show each move? (y/n) ";
+	cin >> showChoice;
+	showMoves = (showChoice == 'y' || showChoice == 'Y') && mode != 3;
+
+	auto startTime = chrono::steady_clock::now();
+	switch (mode)
+	{
+	case 2:
+		iterativeMove(startRow, startColumn);
+		break;
+	case 3:
+		scanlineMove(startRow, startColumn);
+		break;
+	default:
+		recursiveMove(startRow, startColumn);
+		break;
+	}
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - startTime;
+
+	if (!showMoves)
+	{
+		size_t escaped = 0;
+		for (Values cell : maze)
+		{
+			escaped += (cell == Escaped);
+		}
+		cout << moves << " moves, " << escaped << " exits reached" << endl;
+		cout << "Time: " << elapsed.count() * 1000 << " ms" << endl;
+	}
 
 	return 0;
 